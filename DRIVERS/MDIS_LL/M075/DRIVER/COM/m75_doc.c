@@ -82,6 +82,26 @@
 	partly be attached to the data of the current frame, which , in turn, will
 	not be completely returned.
 
+	\n \subsection MbSw Switch M75_MB
+	The Rx and Tx queues are passed between ISR and application without
+	masking the interrupt. M75_MB() is the memory barrier which orders the
+	frame data against the queue counters. It defaults to the gcc builtin
+	__sync_synchronize(). When building with another compiler for a
+	multi-core target, define M75_MB() in the driver(_sw).mak file.
+
+	\n \subsection TsSw Switch M75_TSTAMP_GET
+	Rx timestamps are taken from the OSS tick counter by default. For a finer
+	resolution define M75_TSTAMP_GET(llHdl) and M75_TSTAMP_FREQ(llHdl)
+	(ticks per second) in the driver(_sw).mak file.
+
+	\n \subsection IrqStatSw Switch M75_IRQ_STATS
+	When defined in the driver(_sw).mak file, the ISR keeps log2 histograms
+	of its duration, of the RR03 loops per call and of the frames read per
+	Rx interrupt, returned by Block GetStat M75_BLK_IRQSTATS. The duration is
+	measured with M75_TSTAMP_GET(), so a fine platform timer should be
+	provided (see above). The switch is off by default since it adds two
+	timer reads to every interrupt.
+
     \n \section FuncDesc Functional Description
 
     \n \subsection General General
@@ -102,6 +122,12 @@
 	    declared as reserved must remain as defined in section about \ref
 		scc_register_defaults "M75 SCC register defaults" !!!
 
+	GetStats of the SCC registers access the SCC with the device interrupt
+	masked. With SetStat M75_REG_CACHED enabled, registers which read back a
+	write register (e.g. M75_BRGEN_TCONST, WR12/WR13) are answered from the
+	driver's mirror of the WRxx registers, so polling the configuration does
+	not compete with the ISR. Status registers are always read from the SCC.
+
     \n \subsection channels Logical Channels
 	Two logical channels are assigned to the two physical communication channels
 	of the M75. Every channel has its own, fully supported set of setup
@@ -141,11 +167,172 @@
 	if no data is received. If data is received, M_getblock returns the number
 	of bytes received.
 
+    \n \subsubsection rx_direct Direct Delivery
+	Normally every received frame is read from the external Rx FIFO into the
+	Rx queue by the ISR and copied into the user buffer by M_getblock.
+	With SetStat M75_RX_DIRECT enabled (SYNC mode only), an M_getblock call
+	waiting on an empty Rx queue offers its buffer to the ISR, which then
+	reads the next frame straight into it. The second copy is saved whenever
+	the application keeps up with the receiver. MDIS does not allow to map
+	the driver's queue memory into the application, so this is the closest
+	the driver can get to a zero-copy receive path.
+
+    \n \subsubsection rx_batch Batch Mode
+	Each M_getblock call normally returns one frame. With SetStat
+	M75_RX_BATCH enabled, M_getblock returns all frames ready in the Rx queue
+	which fit into the user buffer, so a burst of small frames costs a single
+	call. Every frame is passed as record: a M75_RX_REC_HDR holding the frame
+	size and timestamp followed by the frame data, padded to a 4 byte
+	boundary. The macro
+	M75_RX_REC_SIZE() gives the size of a record. If an Rx error was detected,
+	the flag M75_RXREC_ERR_PENDING is set in the header of the last record and
+	the next M_getblock returns the error. Direct delivery is not used in
+	batch mode.
+
+    \n \subsubsection rx_tstamp Timestamps
+	The ISR stamps every frame when the end of frame is detected (SYNC mode)
+	or when the first character of a queue entry is received (ASYNC mode), so
+	the time does not include the wakeup latency of the application. With
+	SetStat M75_RX_TSTAMP enabled, M_getblock passes the u_int32 timestamp in
+	front of the frame data. GetStat M75_TSTAMP_RATE returns the timestamp
+	ticks per second.
+
+    \n \subsubsection rx_async_burst ASYNC Burst Mode
+	In ASYNC mode the Rx interrupt reads all characters available in the
+	SCC Rx FIFO and checks RR01 for errors before each of them. With SetStat
+	M75_ASY_RX_BURST enabled, RR01 is checked only once the FIFO is drained.
+	The SCC latches Rx overrun and parity errors until Error Reset, so they
+	are still detected, but the characters of the burst remain in the Rx
+	queue. Framing errors are not latched and may go undetected in this mode.
+
+    \n \subsubsection rx_poll SYNC Polling Mode
+	At high rates of small frames the ISR runs for nearly every frame. With
+	SetStat M75_RX_POLL_HI set, a channel switches to polling mode when more
+	Rx interrupts are counted within one second: the Rx interrupt is
+	disabled and an alarm drains the status FIFO every M75_RX_POLL_MSEC.
+	When less than M75_RX_POLL_LO frames are received within one second, the
+	channel returns to interrupt mode. The status FIFO holds 10 frames, so
+	the poll interval limits the frame rate. GetStat M75_RX_POLL_MODE
+	returns the current mode, M75_STATS the switches and the time spent in
+	each mode.
+
+    \n \subsubsection rx_defer SYNC Deferred Frame Copy
+	Normally the Rx interrupt copies every frame from the external Rx FIFO,
+	up to 2KB with interrupts blocked. With SetStat M75_RX_DEFER the ISR only
+	reads the status FIFO entries (RR01/RR06/RR07), up to 16 are kept. An
+	OSS alarm copies the frames into the Rx queue and wakes the reader one
+	tick later. When the list is full, the Rx interrupt stays off until the
+	alarm has caught up. Frames arriving with the Rx queue full are dropped
+	(M75_ERR_RX_QFULL). Direct delivery (M75_RX_DIRECT) is not used in this
+	mode. Switching M75_RX_DEFER off takes effect once the alarm has read
+	the entries still pending. On most systems the alarm runs at a lower
+	level than device interrupts, check the OSS implementation of the target.
+
+    \n \subsubsection rx_budget SYNC Rx Work Budget
+	The ISR serves both channels in every pass of its RR03 loop, the
+	channel served first alternates. By default an Rx interrupt reads all
+	frames of the status FIFO. SetStat M75_RX_BUDGET limits the frames read
+	per service, the rest is read in the next pass after the other channel
+	was served. So a channel receiving back-to-back small frames can't
+	delay the other channel until its status FIFO overflows.
+
+    \n \subsubsection irq_storm Interrupt Storm Protection
+	A source that keeps asserting its IP (e.g. a floating or toggling modem
+	line) would keep the CPU in the ISR. When IPs are still pending after
+	M75_STORM_LOOPS passes of the RR03 loop, or a channel is serviced more
+	than M75_STORM_RATE times per second, the ISR disables the sources
+	concerned (Rx, Tx or Ext/Status interrupt enable in WR01) and returns.
+	After M75_STORM_MSEC an alarm enables them again; a source still
+	pending is then serviced normally. M75_STATS counts both events,
+	GetStat M75_STORM_STATE shows the sources currently disabled, and the
+	signal installed with M75_SETSTORMSIG is sent on both events. While
+	Tx or Ext/Status interrupts are off, transmission of the channel
+	pauses; while Rx is off, frames beyond the 10 entries of the status
+	FIFO are lost. So M75_STORM_RATE must be well above the rate of the
+	expected traffic, it is off by default.
+
+    \n \subsubsection rx_async_wake ASYNC Wakeup
+	In ASYNC mode a waiting M_getblock and the Rx signal are triggered once
+	the current queue entry holds M75_ASY_RX_MARK characters (default 1) or
+	is full. With M75_ASY_RX_IDLE set, fewer characters are passed when the
+	line stays idle for the given time, so a high water mark does not delay
+	the tail of a message. The signal is sent once per queue entry. On
+	M_getblock timeout, received characters below the water mark are
+	returned instead of the timeout error.
+
     \n \subsubsection rx_sig Using Signals
 	Using signals, the driver sends a signal each time a frame or an error
 	is received. When an error is received, the first M_getblock, after
 	detection of the error, returns the error code. Subsequent M_getblock
 	calls may pick up already received frames waiting in the Rx queue.
+	In SYNC mode, bursts of small frames can cost more in signals than in
+	frame handling. SetStat M75_RX_SIG_FRAMES (key CHAN_n/RX_SIG_FRAMES)
+	sends one signal per n frames, M75_RX_SIG_USEC (key CHAN_n/RX_SIG_USEC)
+	bounds the delay of the first frame not signalled yet, the alarm
+	resolution applies. Rx errors are still signalled at once. M75_STATS
+	rxSig counts the frame signals sent.
+
+    \n \subsection transmit Transmit Data
+	Frames passed with M_setblock are copied into the Tx queue of the driver
+	and sent one after the other, each started by the Tx Underrun/EOM
+	interrupt of the previous frame. The next frame is loaded while the SCC
+	still sends CRC and closing flag of the previous one, so back-to-back
+	frames are only separated by the closing/opening flags. An M_setblock
+	finding the Tx Underrun/EOM latch set in RR00 loads its frame at once,
+	without waiting for the interrupt.
+	With SetStat M75_TX_DIRECT enabled (SYNC mode only), a frame which finds
+	the transmitter idle and the Tx queue empty is written from the user
+	buffer straight into the external Tx FIFO, saving the copy into the
+	Tx queue.
+	With SetStat M75_TX_BATCH enabled, one M_setblock buffer carries a
+	sequence of M75_TX_REC_HDR records. All frames which fit into the Tx queue
+	are queued with a single call and transmission is started once.
+	M_setblock returns the number of bytes of the accepted records, GetStat
+	M75_TX_BATCH_CNT the number of frames. The remaining records can be passed
+	with the next call.
+	In ASYNC mode every character is written by the Tx interrupt of the
+	previous one. With SetStat M75_ASY_TX_FIFO enabled, a queue entry is
+	written into the external Tx FIFO as a whole instead and the Tx interrupt
+	is disabled. An alarm, set to the transmission time estimated from the
+	baudrate and character format, checks that the FIFO has drained and
+	loads the next entry.
+
+    \n \subsubsection tx_done Tx Completion
+	Every frame accepted by M_setblock gets an id, GetStat M75_TX_ID returns
+	the id of the last one. In SYNC mode the Tx Underrun/EOM interrupt, when
+	the frame data has been sent, records a M75_TX_DONE entry with the id,
+	the time the frame was queued and the completion time. Block GetStat
+	M75_BLK_TX_DONE reads the entries in order of transmission, as many as
+	fit into the buffer. The driver keeps the last 64, so read them at
+	least that often or count on M75_STATS txDoneLost. A signal installed
+	with M75_SETTXSIG is sent for every completion. Frames dropped by a
+	Tx FIFO/queue reset are not reported.
+
+    \n \subsubsection tx_drain Waiting for Tx Completion
+	SetStat M75_TX_DRAIN blocks until everything passed for the current
+	channel has been sent: Tx queue and external Tx FIFO empty and, in SYNC
+	mode, the Tx Underrun/EOM of the last frame seen, in ASYNC mode All Sent.
+	The value is a timeout in msec (0: check only, -1: endless), on expiry
+	ERR_OSS_TIMEOUT is returned. In SYNC mode CRC and closing flag of the
+	last frame are still on the wire for up to 3 byte times. Use it instead
+	of delays before closing the path or changing the channel setup.
+
+    \n \subsubsection ev_wait Serving several Channels from one Thread
+	The readiness events tell which channels can be served without
+	blocking: M75_EV_RX (M_getblock returns data), M75_EV_TX (M_setblock
+	finds room in the Tx queue) and M75_EV_ERR (M_getblock returns a Rx
+	error), M75_EV_CH() places them for channel A or B. SetStat M75_EV_MASK
+	selects the events of interest for the device, by default Rx and errors
+	of both channels. GetStat M75_EV_STATE returns the ready ones at once,
+	SetStat M75_EV_WAIT blocks until one is ready (timeout in msec, -1:
+	endless). The events are levels, a channel stays ready until its queue
+	has been read empty. Only one thread per device may block in
+	M75_EV_WAIT, a second one gets ERR_OSS_BUSY_RESOURCE.
+	Across devices, install the same signal with M75_SETEVSIG on each of
+	them. It is sent once when an event of interest gets ready and re-armed
+	by M75_EV_STATE, so after the signal the thread reads M75_EV_STATE of
+	every device and serves the channels reported, no event is lost between
+	signal and read. m75_bench -e shows the event loop for one device.
 
     \n \section interrupts Interrupts
     The driver supports interrupts from the M-Module. The M-Modules interrupt
@@ -175,6 +362,8 @@
 		- wake up waiting M_getblock call.
 
 	Each Tx Underrun/EOM interrupt can trigger the following actions:
+		- record the completion of the frame sent (M75_BLK_TX_DONE).
+		- send a definable user signal to the application (M75_SETTXSIG).
 		- transmit next frame if available in Tx queue of driver.
 		- wake up waiting M_setblock call.
 
@@ -182,6 +371,17 @@
     The driver can send signals to notify the application of received data.
 	The signals must be activated for each channel via the M75_SETRXSIG SetStat
     code and can be cleared through SetStat M75_CLRRXSIG.
+	Tx completions (SYNC mode) are signalled with a separate signal,
+	installed via M75_SETTXSIG and cleared through M75_CLRTXSIG.
+
+    \n \section statistics Statistics
+	The driver counts received and transmitted frames and bytes, Rx errors
+	by cause, Rx/Tx queue full events, Break/Abort events, interrupts by
+	cause and the time spent in Rx interrupt and polling mode for each
+	channel, as well as a histogram of the frame sizes (see M75_STATS). Block GetStat M75_BLK_STATS returns the counters of the
+	current channel, M75_BLK_STATS_CLR returns and resets them within the
+	same snapshot, so no event is lost between reading and resetting.
+	SetStat M75_STATS_CLR only resets the counters.
 
     \n \section id_prom ID PROM
     The M-Module's ID PROM can be checked for validity before the device is
@@ -236,12 +436,82 @@
 							Possible values: 0x01 ... system limitations
 							default: 0x10
 							may be changed with SetStat M75_MAX_TXFRAME_NUM
+	ASYNC_TX_FIFO			ASYNC mode: transmit through external Tx FIFO
+							Possible values: 0, 1
+							default: 0
+							may be changed with SetStat M75_ASY_TX_FIFO
+	ASYNC_RX_BURST			ASYNC mode: check Rx errors once per burst
+							Possible values: 0, 1
+							default: 0
+							may be changed with SetStat M75_ASY_RX_BURST
+	ASYNC_RX_SIG_MARK		ASYNC mode: Rx water mark (bytes) to wake reader
+							Possible values: 1 .. MAX_RXFRAME_SIZE
+							default: 1
+							may be changed with SetStat M75_ASY_RX_MARK
+	ASYNC_RX_IDLE			ASYNC mode: Rx idle time (msec) to wake reader
+							Possible values: 0 (off) .. n
+							default: 0
+							may be changed with SetStat M75_ASY_RX_IDLE
+	RX_POLL_HI				SYNC mode: Rx irqs per sec to switch to polling
+							Possible values: 0 (off) .. n
+							default: 0
+							may be changed with SetStat M75_RX_POLL_HI
+	RX_POLL_LO				SYNC mode: Rx frames per sec to leave polling
+							Possible values: 0 .. n
+							default: 100
+							may be changed with SetStat M75_RX_POLL_LO
+	RX_POLL_MSEC			SYNC mode: Rx poll interval (msec)
+							Possible values: 1 .. n
+							default: 10
+							may be changed with SetStat M75_RX_POLL_MSEC
+	RX_DEFER				SYNC mode: read Rx frames outside the ISR
+							Possible values: 0, 1
+							default: 0
+							may be changed with SetStat M75_RX_DEFER
+	RX_BUDGET				SYNC mode: max. frames per Rx interrupt service
+							Possible values: 0 (unlimited) .. n
+							default: 0
+							may be changed with SetStat M75_RX_BUDGET
+	RX_SIG_FRAMES			SYNC mode: frames per Rx signal
+							Possible values: 1 (every frame) .. n
+							default: 1
+							may be changed with SetStat M75_RX_SIG_FRAMES
+	RX_SIG_USEC				SYNC mode: max. Rx signal delay (usec)
+							Possible values: 0 (none) .. n
+							default: 0
+							may be changed with SetStat M75_RX_SIG_USEC
+	IRQ_STORM_LOOPS			max. RR03 passes per ISR call (device)
+							Possible values: 0 (off) .. n
+							default: 100
+							may be changed with SetStat M75_STORM_LOOPS
+	IRQ_STORM_RATE			max. interrupts per sec and channel (device)
+							Possible values: 0 (off) .. n
+							default: 0
+							may be changed with SetStat M75_STORM_RATE
+	IRQ_STORM_MSEC			storm backoff (msec) (device)
+							Possible values: 1 .. n
+							default: 100
+							may be changed with SetStat M75_STORM_MSEC
     </pre>
 
 
     \n \section codes M75 specific Getstat/Setstat codes
     see section about \ref getstat_setstat_codes "Getstat/Setstat codes"
 
+    \n \section simulator Host Simulator
+	TEST/M75_SIM/COM builds the driver and the test/example programs for the
+	development host (GNU make, gcc, pthreads) against a register model of
+	the M-Module: Z85230 SCC, external FIFOs and ID PROM. A wire engine
+	clocks the transmitters at the BR generator rate and calls M75_Irq().
+	The Tx line of a channel is looped back to its own receiver; with
+	M75SIM_WIRE=cross, channel A and B are connected.
+	Descriptor keys are taken from the environment, prefixed with M75SIM_
+	and '/' replaced by '_' (e.g. M75SIM_CHAN_0_SYNC_MODE=0).
+	M75SIM_CRC_ERR=n corrupts the CRC of every n-th frame,
+	M75SIM_TRACE=1 traces frames (2: async characters) on stderr.
+	"make check" runs m75_endtest on both channels and m75_async, with
+	and without M75_ASY_TX_FIFO and M75_ASY_RX_BURST.
+
     \n \section Documents Overview of all Documents
 
     \subsection m75_simp  Simple example for using the driver
@@ -37,10 +37,20 @@ static const char IdentString[]=MENT_XSTR(MAK_REVISION);
 /*-----------------------------------------+
 |  DEFINES                                 |
 +-----------------------------------------*/
+#define M75_ALARM_NUM		6	/**< alarms per channel, see M75_ChanAlarms() */
 
 /*-----------------------------------------+
 |  TYPEDEFS                                |
 +-----------------------------------------*/
+/** channel alarm, routine and handle */
+typedef struct {
+	void				(*funct)(void *arg);	/**< alarm routine */
+	OSS_ALARM_HANDLE	**hdlP;					/**< handle in CHN_OBJ */
+} M75_ALARM;
+
+/** M75_Wait() check, called with IRQs masked: TRUE when done, otherwise
+ *  *pollP may limit the wait (msec, 0: until woken) */
+typedef u_int8 (*M75_WAIT_CHECK)(LL_HANDLE *llHdl, int32 ch, u_int32 *pollP);
 
 /*-----------------------------------------+
 |  PROTOTYPES                              |
@@ -58,19 +68,61 @@ static int32 M75_BlockRead(LL_HANDLE *llHdl, int32 ch, void *buf, int32 size,
 static int32 M75_BlockWrite(LL_HANDLE *llHdl, int32 ch, void *buf, int32 size,
 							 int32 *nbrWrBytesP);
 static int32 M75_Irq(LL_HANDLE *llHdl );
+static void M75_IrqChan(LL_HANDLE *llHdl, u_int32 ch, u_int32 ip);
+static void M75_RxPollMode(LL_HANDLE *llHdl, u_int32 ch, u_int8 poll);
+static void M75_RxPollAlarm(void *arg);
+static void M75_RxModeTime(LL_HANDLE *llHdl, u_int32 ch);
+static u_int32 M75_MsecLeft(LL_HANDLE *llHdl, u_int32 start, u_int32 msec);
+static void M75_IrqStorm(LL_HANDLE *llHdl, u_int32 ch, u_int32 ip);
+static void M75_StormAlarm(void *arg);
 static int32 M75_Info(int32 infoType, ... );
 
 static char* Ident( void );
 static int32 Cleanup(LL_HANDLE *llHdl, int32 retCode);
+static void M75_ChanAlarms(CHN_OBJ *chP, M75_ALARM *alarm);
 
 static int32 M75_Tx(LL_HANDLE *llHdl, int32 ch);
 static int32 M75_TxFrame_Sync(LL_HANDLE *llHdl, int32 ch);
+static u_int8 M75_TxClaim_Sync(LL_HANDLE *llHdl, int32 ch);
+static void M75_TxWire_Sync(LL_HANDLE *llHdl, int32 ch, u_int32 id,
+							u_int32 tQueued);
+static void M75_TxStart_Sync(LL_HANDLE *llHdl, int32 ch, u_int8 *frame,
+							 u_int32 size);
+static void M75_TxDone(LL_HANDLE *llHdl, int32 ch);
+static int32 M75_Wait(LL_HANDLE *llHdl, int32 ch, int32 tout,
+					 OSS_SEM_HANDLE *sem, u_int8 *waitP,
+					 M75_WAIT_CHECK check);
+static int32 M75_TxDrain(LL_HANDLE *llHdl, int32 ch, int32 tout);
+static u_int8 M75_TxDrainCheck(LL_HANDLE *llHdl, int32 ch, u_int32 *pollP);
+static u_int8 M75_TxIdle(LL_HANDLE *llHdl, int32 ch);
+static void M75_TxDrainWake(LL_HANDLE *llHdl, int32 ch);
+static u_int32 M75_EvState(LL_HANDLE *llHdl);
+static void M75_EvCheck(LL_HANDLE *llHdl);
+static int32 M75_EvWait(LL_HANDLE *llHdl, int32 tout);
+static u_int8 M75_EvCheckWait(LL_HANDLE *llHdl, int32 ch, u_int32 *pollP);
 static int32 M75_TxData_Async(LL_HANDLE *llHdl, int32 ch);
+static int32 M75_TxFifo_Async(LL_HANDLE *llHdl, int32 ch);
+static void M75_TxFifoAlarm(void *arg);
+static u_int32 M75_TxFifoMsec(LL_HANDLE *llHdl, int32 ch, u_int32 size);
+static void M75_RxIdleAlarm(void *arg);
 /* static int32 M75_TxFrame_AsyncIrq(LL_HANDLE *llHdl, int32 ch); */
 
 static int32 M75_IrqRx(LL_HANDLE *llHdl, u_int32 ch);
-static int32 M75_IrqRx_Frame_Sync(LL_HANDLE *llHdl, u_int32 ch);
+static int32 M75_IrqRx_Frame_Sync(LL_HANDLE *llHdl, u_int32 ch,
+								  u_int32 budget);
+static int32 M75_RxDrain_Sync(LL_HANDLE *llHdl, u_int32 ch, u_int32 budget);
+static int32 M75_RxFrame_Sync(LL_HANDLE *llHdl, u_int32 ch, u_int8 rr1,
+							  u_int8 rr7, u_int32 rxSize, u_int32 tstamp,
+							  u_int8 dataRead, u_int8 *wakeP);
+static void M75_RxFrameRead(LL_HANDLE *llHdl, u_int32 ch, RX_PEND *pend,
+							u_int8 *frame);
+static void M75_RxDeferAlarm(void *arg);
+static void M75_RxPendArm(LL_HANDLE *llHdl, u_int32 ch);
+static void M75_RxPendResume(LL_HANDLE *llHdl, u_int32 ch);
+static void M75_RxSig(LL_HANDLE *llHdl, u_int32 ch);
+static void M75_RxSigAlarm(void *arg);
 static int32 M75_IrqRx_Data_Async(LL_HANDLE *llHdl, u_int32 ch);
+static void M75_RxWake(LL_HANDLE *llHdl, u_int32 ch);
 
 #ifdef M75_SUPPORT_BREAK_ABORT
 static int32 M75_BreakAbortHandler(LL_HANDLE *llHdl, u_int32 ch);
@@ -78,6 +130,17 @@ static int32 M75_BreakAbortHandler(LL_HANDLE *llHdl, u_int32 ch);
 
 static int32 M75_RedoQ(LL_HANDLE *llHdl, MQUEUE_HEAD *compQ);
 static int32 M75_ResetQ(MQUEUE_HEAD *compQ);
+static int32 M75_RxDirectTake(LL_HANDLE *llHdl, MQUEUE_HEAD *rxQ,
+							  int32 *nbrRdBytesP);
+static int32 M75_RxBatch(LL_HANDLE *llHdl, int32 ch, u_int8 *buf, int32 size,
+						 int32 *nbrRdBytesP);
+static int32 M75_TxBatch(LL_HANDLE *llHdl, int32 ch, u_int8 *buf, int32 size,
+						 int32 *nbrWrBytesP);
+static int32 M75_SccRegCached(LL_HANDLE *llHdl, int32 code, int32 ch,
+							 u_int32 *valP);
+#ifdef M75_IRQ_STATS
+static void M75_IrqStats(LL_HANDLE *llHdl, u_int32 irqTime, u_int32 loops);
+#endif
 
 /****************************** M75_GetEntry ********************************/
 /** Initialize driver's jump table
@@ -114,10 +177,24 @@ extern void M75_GetEntry( LL_ENTRY* drvP )
  * DEBUG_LEVEL_DESC      OSS_DBG_DEFAULT  see dbg.h
  * DEBUG_LEVEL           OSS_DBG_DEFAULT  see dbg.h
  * ID_CHECK              1                0 .. 1
+ * IRQ_STORM_LOOPS       100              0 .. (RR03 passes per ISR call)
+ * IRQ_STORM_RATE        0                0 .. (irqs per sec and channel)
+ * IRQ_STORM_MSEC        100              1 .. (msec)
  * MAX_RXFRAME_SIZE      FRAME_SIZE_DEF   1 .. 0x800
  * MAX_TXFRAME_SIZE      FRAME_SIZE_DEF   1 .. 0x800
  * MAX_RXFRAME_NUM       FRAME_NUM_DEF    1 .. system limitations
  * MAX_TXFRAME_NUM       FRAME_NUM_DEF    1 .. system limitations
+ * ASYNC_TX_FIFO         0                0 .. 1
+ * ASYNC_RX_BURST        0                0 .. 1
+ * ASYNC_RX_SIG_MARK     1                1 .. MAX_RXFRAME_SIZE
+ * ASYNC_RX_IDLE         0                0 .. (msec)
+ * RX_POLL_HI            0                0 .. (Rx irqs per sec)
+ * RX_POLL_LO            100              0 .. (Rx frames per sec)
+ * RX_POLL_MSEC          10               1 .. (msec)
+ * RX_DEFER              0                0 .. 1
+ * RX_BUDGET             0                0 .. (frames)
+ * RX_SIG_FRAMES         1                1 .. (frames)
+ * RX_SIG_USEC           0                0 .. (usec)
  * \endcode
  *
  *  \param descP      \IN  pointer to descriptor data
@@ -142,7 +219,8 @@ static int32 M75_Init(
     u_int32 gotsize;
     int32 error=0;
     u_int32 value, irqEnable=0;
-	u_int32 ch;
+	u_int32 ch, i;
+	M75_ALARM alarm[M75_ALARM_NUM];
 
     DBGCMD( static const char functionName[] = "LL - M75_Init()"; )
     /*------------------------------+
@@ -216,6 +294,26 @@ static int32 M75_Init(
 		error != ERR_DESC_KEY_NOTFOUND)
 		return( Cleanup(llHdl,error) );
 
+    /* IRQ_STORM_LOOPS */
+    if ((error = DESC_GetUInt32(llHdl->descHdl, M75_STORM_LOOPS_DEF,
+								&llHdl->stormLoops, "IRQ_STORM_LOOPS")) &&
+		error != ERR_DESC_KEY_NOTFOUND)
+		return( Cleanup(llHdl,error) );
+
+    /* IRQ_STORM_RATE */
+    if ((error = DESC_GetUInt32(llHdl->descHdl, 0,
+								&llHdl->stormRate, "IRQ_STORM_RATE")) &&
+		error != ERR_DESC_KEY_NOTFOUND)
+		return( Cleanup(llHdl,error) );
+
+    /* IRQ_STORM_MSEC */
+    if ((error = DESC_GetUInt32(llHdl->descHdl, M75_STORM_MSEC_DEF,
+								&llHdl->stormMsec, "IRQ_STORM_MSEC")) &&
+		error != ERR_DESC_KEY_NOTFOUND)
+		return( Cleanup(llHdl,error) );
+	if( llHdl->stormMsec < 1 )
+		llHdl->stormMsec = 1;
+
 	for(ch=0; ch < CH_NUMBER; ch++){
 		/* SYNC_MODE */
 		if ((error = DESC_GetUInt32(llHdl->descHdl, M75_SYNC_MODE,
@@ -232,6 +330,27 @@ static int32 M75_Init(
 				error != ERR_DESC_KEY_NOTFOUND)
 				return( Cleanup(llHdl,error) );
 			llHdl->chan[ch].asyRxSigWaterM = value;
+
+			/* ASYNC_TX_FIFO */
+			if ((error = DESC_GetUInt32(llHdl->descHdl, 0,
+										&value, "CHAN_%d/ASYNC_TX_FIFO", ch)) &&
+				error != ERR_DESC_KEY_NOTFOUND)
+				return( Cleanup(llHdl,error) );
+			llHdl->chan[ch].asyTxFifo = (value != 0);
+
+			/* ASYNC_RX_BURST */
+			if ((error = DESC_GetUInt32(llHdl->descHdl, 0,
+										&value, "CHAN_%d/ASYNC_RX_BURST", ch)) &&
+				error != ERR_DESC_KEY_NOTFOUND)
+				return( Cleanup(llHdl,error) );
+			llHdl->chan[ch].asyRxBurst = (value != 0);
+
+			/* ASYNC_RX_IDLE */
+			if ((error = DESC_GetUInt32(llHdl->descHdl, 0,
+										&llHdl->chan[ch].asyRxIdle,
+										"CHAN_%d/ASYNC_RX_IDLE", ch)) &&
+				error != ERR_DESC_KEY_NOTFOUND)
+				return( Cleanup(llHdl,error) );
 		}
 		/* MAX_RXFRAME_SIZE */
 		if ((error = DESC_GetUInt32(llHdl->descHdl, FRAME_SIZE_DEF,
@@ -254,6 +373,59 @@ static int32 M75_Init(
 			error != ERR_DESC_KEY_NOTFOUND)
 			return( Cleanup(llHdl,error) );
 
+		/* RX_POLL_HI */
+		if ((error = DESC_GetUInt32(llHdl->descHdl, 0,
+									&llHdl->chan[ch].rxPollHi,
+									"CHAN_%d/RX_POLL_HI", ch)) &&
+			error != ERR_DESC_KEY_NOTFOUND)
+			return( Cleanup(llHdl,error) );
+
+		/* RX_POLL_LO */
+		if ((error = DESC_GetUInt32(llHdl->descHdl, M75_RX_POLL_LO_DEF,
+									&llHdl->chan[ch].rxPollLo,
+									"CHAN_%d/RX_POLL_LO", ch)) &&
+			error != ERR_DESC_KEY_NOTFOUND)
+			return( Cleanup(llHdl,error) );
+
+		/* RX_POLL_MSEC */
+		if ((error = DESC_GetUInt32(llHdl->descHdl, M75_RX_POLL_MSEC_DEF,
+									&llHdl->chan[ch].rxPollMsec,
+									"CHAN_%d/RX_POLL_MSEC", ch)) &&
+			error != ERR_DESC_KEY_NOTFOUND)
+			return( Cleanup(llHdl,error) );
+		if( !llHdl->chan[ch].rxPollMsec )
+			llHdl->chan[ch].rxPollMsec = 1;
+
+		/* RX_DEFER */
+		if ((error = DESC_GetUInt32(llHdl->descHdl, 0,
+									&value, "CHAN_%d/RX_DEFER", ch)) &&
+			error != ERR_DESC_KEY_NOTFOUND)
+			return( Cleanup(llHdl,error) );
+		llHdl->chan[ch].rxDefer = (value != 0);
+
+		/* RX_BUDGET */
+		if ((error = DESC_GetUInt32(llHdl->descHdl, 0,
+									&llHdl->chan[ch].rxBudget,
+									"CHAN_%d/RX_BUDGET", ch)) &&
+			error != ERR_DESC_KEY_NOTFOUND)
+			return( Cleanup(llHdl,error) );
+
+		/* RX_SIG_FRAMES */
+		if ((error = DESC_GetUInt32(llHdl->descHdl, 1,
+									&llHdl->chan[ch].rxSigFrames,
+									"CHAN_%d/RX_SIG_FRAMES", ch)) &&
+			error != ERR_DESC_KEY_NOTFOUND)
+			return( Cleanup(llHdl,error) );
+		if( !llHdl->chan[ch].rxSigFrames )
+			llHdl->chan[ch].rxSigFrames = 1;
+
+		/* RX_SIG_USEC */
+		if ((error = DESC_GetUInt32(llHdl->descHdl, 0,
+									&llHdl->chan[ch].rxSigUsec,
+									"CHAN_%d/RX_SIG_USEC", ch)) &&
+			error != ERR_DESC_KEY_NOTFOUND)
+			return( Cleanup(llHdl,error) );
+
 		/* MAX_TXFRAME_NUM */
 		if ((error = DESC_GetUInt32(llHdl->descHdl, FRAME_NUM_DEF,
 									&llHdl->chan[ch].txQ.maxFrameNum,
@@ -330,6 +502,15 @@ static int32 M75_Init(
 	/* reset FIFOs */
 	MWRITE_D8( llHdl->ma, FIFO_RESET_REG, 0x55 );
 
+	/* init readiness waiter semaphore */
+	llHdl->evMask = M75_EV_MASK_DEF;
+	if( (error = OSS_SemCreate( llHdl->osHdl, OSS_SEM_BIN, 0,
+								&llHdl->evSem )) ){
+
+			DBGWRT_ERR((DBH,"*** %s: error 0x%x creating sem\n", functionName, error));
+			return( Cleanup(llHdl, error) );
+	}
+
 	/*----------------------+
     |  init channels (llHdl)|
     +----------------------*/
@@ -340,6 +521,10 @@ static int32 M75_Init(
 		/* init flags */
 		llHdl->chan[ch].txUnderrEOMgot = 1;
 		llHdl->chan[ch].txBufEmpty = 1;
+		llHdl->chan[ch].txFifoSt = M75_TXF_IDLE;
+		llHdl->chan[ch].llHdl = llHdl;
+		llHdl->chan[ch].num = ch;
+		llHdl->chan[ch].rxModeStart = M75_TSTAMP_GET(llHdl);
 
 		/* init queues */
 		llHdl->chan[ch].getBlockTout = GETSETBLOCK_TOUT;
@@ -358,6 +543,24 @@ static int32 M75_Init(
 				DBGWRT_ERR((DBH,"*** %s: error 0x%x creating sem\n", functionName, error));
 				return( Cleanup(llHdl, error) );
 		}
+		if( (error = OSS_SemCreate( llHdl->osHdl, OSS_SEM_BIN, 0,
+									&llHdl->chan[ch].txDrainSem )) ){
+
+				DBGWRT_ERR((DBH,"*** %s: error 0x%x creating sem\n", functionName, error));
+				return( Cleanup(llHdl, error) );
+		}
+
+		/* init alarms: Tx FIFO, Rx idle, Rx poll, Rx defer, storm, Rx signal */
+		M75_ChanAlarms( &llHdl->chan[ch], alarm );
+		for( i=0; i<M75_ALARM_NUM; i++ ) {
+			if( (error = OSS_AlarmCreate( llHdl->osHdl, alarm[i].funct,
+										  &llHdl->chan[ch],
+										  alarm[i].hdlP )) ){
+
+				DBGWRT_ERR((DBH,"*** %s: error 0x%x creating alarm\n", functionName, error));
+				return( Cleanup(llHdl, error) );
+			}
+		}
 
 		/* allocate RxQ */
 		DBGWRT_3((DBH, "      init queue for channel %d\n", ch));
@@ -476,7 +679,8 @@ static int32 M75_Exit(
 )
 {
     LL_HANDLE *llHdl = *llHdlP;
-	int32 error = 0, ch;
+	int32 error = 0, ch, i;
+	M75_ALARM alarm[M75_ALARM_NUM];
 
     DBGWRT_1((DBH, "LL - M75_Exit\n"));
 
@@ -485,6 +689,9 @@ static int32 M75_Exit(
     +------------------------------*/
 	/* disabling receiver and transmitter */
 	for( ch=0; ch< CH_NUMBER; ch++ ) {
+		M75_ChanAlarms( &llHdl->chan[ch], alarm );
+		for( i=0; i<M75_ALARM_NUM; i++ )
+			OSS_AlarmClear( llHdl->osHdl, *alarm[i].hdlP );
 		WRITE_SCC_REG( llHdl->ma, ch, M75_R03, 0x00 );
 		WRITE_SCC_REG( llHdl->ma, ch, M75_R05, 0x00 );
 	}
@@ -545,7 +752,8 @@ static int32 M75_SetStat(
 )
 {
 	int32 error = ERR_SUCCESS;
-	u_int8 ich, wr14, retVal = 0;
+	u_int8 ich, wr14, wr15, retVal = 0;
+	OSS_IRQ_STATE irqState;
 	int32		value	= (int32)value32_or_64;	/* 32bit value     */
 	/*INT32_OR_64	valueP  = value32_or_64;*/		/* stores 32/64bit pointer */
 
@@ -582,11 +790,23 @@ static int32 M75_SetStat(
         |  enable M75 board interrupts   |
         +-------------------------------*/
         case M75_IRQ_ENABLE:
+			/* leave Rx polling and storm backoff, interrupts are set below;
+			 * a stormAlarm still set finds stormMask cleared */
+			irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+			llHdl->chan[ch].stormMask = 0;
+			if( llHdl->chan[ch].rxPolling )
+				M75_RxPollMode( llHdl, ch, FALSE );
+			OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+
 			if( value ) {
 				/* SCC various interrupt control; */
 				if( M75_SYNC_MODE == llHdl->chan[ch].syncMode ) {
 					WRITE_SCC_REG( llHdl->ma, ch, M75_R01,
 									(llHdl->chan[ch].sccRegs.wr01 | M75_SCC_WR01_EXT_IE | M75_SCC_WR01_RX_SPEC_ONLY_IE) );
+				} else if( llHdl->chan[ch].asyTxFifo ) {
+					/* async, Tx fed by external FIFO: no Tx interrupt */
+					WRITE_SCC_REG( llHdl->ma, ch, M75_R01,
+									((llHdl->chan[ch].sccRegs.wr01 & ~M75_SCC_WR01_TX_IE) | M75_SCC_WR01_EXT_IE | M75_SCC_WR01_RX_ALL_SPEC_IE) );
 				} else { /* async */
 					WRITE_SCC_REG( llHdl->ma, ch, M75_R01,
 									(llHdl->chan[ch].sccRegs.wr01 | M75_SCC_WR01_EXT_IE | M75_SCC_WR01_TX_IE | M75_SCC_WR01_RX_ALL_SPEC_IE) );
@@ -627,6 +847,8 @@ static int32 M75_SetStat(
 			WRITE_SCC_REG( llHdl->ma, ch, M75_R02, (u_int8)value );
 			break;
 		case M75_SCC_REG_03:
+			/* the Status FIFO reset must not drop the Ext/Status IEs */
+			wr15 = llHdl->chan[ch].sccRegs.wr15;
 			if( !(llHdl->chan[ch].sccRegs.wr03 & M75_SCC_WR03_RX_EN) &&
 				( value & 0x01 ) ) {/* enabling receiver */
 				if( !llHdl->chan[ch].irqEnabled ) {
@@ -649,7 +871,7 @@ static int32 M75_SetStat(
 			/* when Rx Enabled, Status FIFO has always to be enabled */
 			if( value & 0x01 )
 				WRITE_SCC_REG( llHdl->ma, ch, M75_R15,
-								llHdl->chan[ch].sccRegs.wr15 | M75_SCC_WR15_SDLC_FIFO_EN );
+								wr15 | M75_SCC_WR15_SDLC_FIFO_EN );
 
 			WRITE_SCC_REG( llHdl->ma, ch, M75_R03, (u_int8)value );
 			break;
@@ -791,13 +1013,23 @@ static int32 M75_SetStat(
 			break;
 		case M75_FIFO_RESET:
 			if( value ) {
+				/* ISR and M75_RxDeferAlarm use the FIFOs and queues */
+				irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
 				/* mask value with 0x05, only current channel is set */
 				MWRITE_D8( llHdl->ma, FIFO_RESET_REG, (((u_int8)value & 0x05) << (ch*4)) );
-				if( value & 0x4 ) /* reset RxQ */
+				if( value & 0x4 ) { /* reset RxQ */
 					M75_ResetQ(	&llHdl->chan[ch].rxQ );
+					/* data of pending status entries is gone, a deferAlarm
+					 * still set finds the list empty and clears rxPendArmed */
+					llHdl->chan[ch].rxPendGet = llHdl->chan[ch].rxPendPut;
+					M75_RxPendResume( llHdl, ch );
+				}
 
-				if( value & 0x1 ) /* reset TxQ */
+				if( value & 0x1 ) { /* reset TxQ */
 					M75_ResetQ(	&llHdl->chan[ch].txQ );
+					llHdl->chan[ch].txFifoSt = M75_TXF_IDLE;
+				}
+				OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
 			}
 			break;
 		case M75_TXEN:
@@ -925,9 +1157,208 @@ static int32 M75_SetStat(
 			if( llHdl->chan[ch].sig == NULL )
 				return( M75_ERR_SIGBUSY );
 
+			/* drop a coalesced signal still pending,
+			 * a sigAlarm still set finds no frames */
+			irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+			llHdl->chan[ch].rxSigCnt = 0;
+			OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+
 			error = OSS_SigRemove( llHdl->osHdl,
 									&llHdl->chan[ch].sig );
 			break;
+		case M75_SETSTORMSIG:
+			if( llHdl->chan[ch].stormSig != NULL )
+				return( M75_ERR_SIGBUSY );
+
+			if( (error = OSS_SigCreate( llHdl->osHdl,
+										value,
+										&llHdl->chan[ch].stormSig )))
+				llHdl->chan[ch].stormSig = NULL;
+			break;
+		case M75_CLRSTORMSIG:
+			if( llHdl->chan[ch].stormSig == NULL )
+				return( M75_ERR_SIGBUSY );
+
+			error = OSS_SigRemove( llHdl->osHdl,
+									&llHdl->chan[ch].stormSig );
+			break;
+		case M75_SETTXSIG:
+			if( llHdl->chan[ch].txSig != NULL )
+				return( M75_ERR_SIGBUSY );
+
+			if( (error = OSS_SigCreate( llHdl->osHdl,
+										value,
+										&llHdl->chan[ch].txSig )))
+				llHdl->chan[ch].txSig = NULL;
+			break;
+		case M75_CLRTXSIG:
+			if( llHdl->chan[ch].txSig == NULL )
+				return( M75_ERR_SIGBUSY );
+
+			error = OSS_SigRemove( llHdl->osHdl,
+									&llHdl->chan[ch].txSig );
+			break;
+		case M75_RX_DIRECT:
+			if( (value != 0) && (value != 1) )
+				return( ERR_LL_ILL_PARAM );
+			llHdl->chan[ch].rxDirect = (u_int8)value;
+			break;
+		case M75_TX_DIRECT:
+			if( (value != 0) && (value != 1) )
+				return( ERR_LL_ILL_PARAM );
+			llHdl->chan[ch].txDirect = (u_int8)value;
+			break;
+		case M75_RX_BATCH:
+			if( (value != 0) && (value != 1) )
+				return( ERR_LL_ILL_PARAM );
+			llHdl->chan[ch].rxBatch = (u_int8)value;
+			break;
+		case M75_TX_BATCH:
+			if( (value != 0) && (value != 1) )
+				return( ERR_LL_ILL_PARAM );
+			llHdl->chan[ch].txBatch = (u_int8)value;
+			break;
+		case M75_RX_TSTAMP:
+			if( (value != 0) && (value != 1) )
+				return( ERR_LL_ILL_PARAM );
+			llHdl->chan[ch].rxTstamp = (u_int8)value;
+			break;
+		case M75_REG_CACHED:
+			if( (value != 0) && (value != 1) )
+				return( ERR_LL_ILL_PARAM );
+			llHdl->chan[ch].regCached = (u_int8)value;
+			break;
+		case M75_ASY_TX_FIFO:
+			if( (value != 0) && (value != 1) )
+				return( ERR_LL_ILL_PARAM );
+			llHdl->chan[ch].asyTxFifo = (u_int8)value;
+			if( (M75_SYNC_MODE != llHdl->chan[ch].syncMode) &&
+				llHdl->chan[ch].irqEnabled ) {
+				/* Tx interrupt per character only without FIFO */
+				if( value )
+					WRITE_SCC_REG( llHdl->ma, ch, M75_R01,
+								   llHdl->chan[ch].sccRegs.wr01 & ~M75_SCC_WR01_TX_IE );
+				else
+					WRITE_SCC_REG( llHdl->ma, ch, M75_R01,
+								   llHdl->chan[ch].sccRegs.wr01 | M75_SCC_WR01_TX_IE );
+			}
+			break;
+		case M75_ASY_RX_BURST:
+			if( (value != 0) && (value != 1) )
+				return( ERR_LL_ILL_PARAM );
+			llHdl->chan[ch].asyRxBurst = (u_int8)value;
+			break;
+		case M75_ASY_RX_MARK:
+			if( value < 1 )
+				return( ERR_LL_ILL_PARAM );
+			llHdl->chan[ch].asyRxSigWaterM = value;
+			break;
+		case M75_ASY_RX_IDLE:
+			if( value < 0 )
+				return( ERR_LL_ILL_PARAM );
+			llHdl->chan[ch].asyRxIdle = value;
+			break;
+		case M75_RX_POLL_HI:
+			if( value < 0 )
+				return( ERR_LL_ILL_PARAM );
+			irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+			llHdl->chan[ch].rxPollHi = value;
+			if( !value && llHdl->chan[ch].rxPolling )
+				M75_RxPollMode( llHdl, ch, FALSE );
+			OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+			break;
+		case M75_RX_POLL_LO:
+			if( value < 0 )
+				return( ERR_LL_ILL_PARAM );
+			llHdl->chan[ch].rxPollLo = value;
+			break;
+		case M75_RX_POLL_MSEC:
+			if( value < 1 )
+				return( ERR_LL_ILL_PARAM );
+			llHdl->chan[ch].rxPollMsec = value;
+			break;
+		case M75_RX_BUDGET:
+			if( value < 0 )
+				return( ERR_LL_ILL_PARAM );
+			llHdl->chan[ch].rxBudget = value;
+			break;
+		case M75_RX_SIG_FRAMES:
+			if( value < 1 )
+				return( ERR_LL_ILL_PARAM );
+			llHdl->chan[ch].rxSigFrames = value;
+			break;
+		case M75_RX_SIG_USEC:
+			if( value < 0 )
+				return( ERR_LL_ILL_PARAM );
+			llHdl->chan[ch].rxSigUsec = value;
+			break;
+		case M75_STORM_LOOPS:
+			if( value < 0 )
+				return( ERR_LL_ILL_PARAM );
+			llHdl->stormLoops = value;
+			break;
+		case M75_STORM_RATE:
+			if( value < 0 )
+				return( ERR_LL_ILL_PARAM );
+			llHdl->stormRate = value;
+			break;
+		case M75_STORM_MSEC:
+			if( value < 1 )
+				return( ERR_LL_ILL_PARAM );
+			llHdl->stormMsec = value;
+			break;
+		case M75_RX_DEFER:
+			if( (value != 0) && (value != 1) )
+				return( ERR_LL_ILL_PARAM );
+			irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+			llHdl->chan[ch].rxDefer = (u_int8)value;
+			/* the ISR defers until the pending entries are read */
+			M75_RxPendArm( llHdl, ch );
+			OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+			break;
+		case M75_TX_DRAIN:
+			error = M75_TxDrain( llHdl, ch, value );
+			break;
+		case M75_EV_MASK:
+			irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+			llHdl->evMask = value;
+			M75_EvCheck( llHdl );
+			OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+			break;
+		case M75_EV_WAIT:
+			error = M75_EvWait( llHdl, value );
+			break;
+		case M75_SETEVSIG:
+			if( llHdl->evSig != NULL )
+				return( M75_ERR_SIGBUSY );
+
+			if( (error = OSS_SigCreate( llHdl->osHdl,
+										value,
+										&llHdl->evSig ))) {
+				llHdl->evSig = NULL;
+				break;
+			}
+			irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+			llHdl->evArmed = TRUE;
+			M75_EvCheck( llHdl );
+			OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+			break;
+		case M75_CLREVSIG:
+			if( llHdl->evSig == NULL )
+				return( M75_ERR_SIGBUSY );
+
+			irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+			llHdl->evArmed = FALSE;
+			OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+			error = OSS_SigRemove( llHdl->osHdl, &llHdl->evSig );
+			break;
+		case M75_STATS_CLR:
+			irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+			M75_RxModeTime( llHdl, ch );
+			OSS_MemFill( llHdl->osHdl, sizeof(M75_STATS),
+						 (char*)&llHdl->chan[ch].stats, 0x00 );
+			OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+			break;
 
 		/*--------------------------+
 		|  (unknown)                |
@@ -961,7 +1392,7 @@ static int32 M75_RedoQ(
 
 	/* delete old queue if existant */
 	if( compQ->first ) {
-		compQ->totEntries = 0;
+		compQ->putCnt = compQ->getCnt = 0;
 		/* free all allocated memory in queue */
 		OSS_MemFree(llHdl->osHdl, compQ->startAlloc, compQ->memAlloc);
 		compQ->startAlloc = NULL;
@@ -995,12 +1426,10 @@ static int32 M75_RedoQ(
 
 	/* init queue */
 	compQ->last = qEnt++;
-	compQ->last->ready = 0;
 	compQ->last->frame = datap;
 	for(i = 1; i < compQ->maxFrameNum; i++){
 		compQ->last->next = qEnt; /* attach to last */
 		compQ->last = qEnt++;
-		compQ->last->ready = 0;
 		datap += compQ->maxFrameSize;
 		compQ->last->frame = datap;
 	}
@@ -1010,6 +1439,7 @@ static int32 M75_RedoQ(
 	compQ->last->next = compQ->first;
 	/* queue empty => last points to same as first */
 	compQ->last = compQ->first;
+	compQ->putCnt = compQ->getCnt = 0;
 	return( ERR_SUCCESS );
 
 
@@ -1034,9 +1464,9 @@ static int32 M75_ResetQ(
 		do {
 			compQ->first=compQ->first->next;
 			compQ->first->size=0;
-			compQ->first->ready=0;
+			compQ->first->xfering=0;
 		} while(compQ->first != compQ->last);
-		compQ->totEntries=0;
+		compQ->putCnt = compQ->getCnt = 0;
 	}
 
 	/* take queue back online */
@@ -1045,6 +1475,69 @@ static int32 M75_ResetQ(
 	return( ERR_SUCCESS );
 
 }
+/**************************** M75_SccRegCached ******************************/
+/** Get SCC register value from the WRxx mirror (M75_REG_CACHED)
+ *
+ *  Only registers which read back a write register are served, following
+ *  the (extended read) mapping of the Z85230.
+ *
+ *  \param llHdl      \IN  low-level handle
+ *  \param code       \IN  M75_SCC_REG_xx or M75_BRGEN_TCONST
+ *  \param ch         \IN  current channel
+ *  \param valP       \OUT register value
+ *
+ *  \return           TRUE if served from mirror, FALSE if SCC must be read
+ */
+static int32 M75_SccRegCached(
+	LL_HANDLE *llHdl,
+	int32 code,
+	int32 ch,
+	u_int32 *valP
+)
+{
+	SCC_REG *regs = &llHdl->chan[ch].sccRegs;
+	int32 ext = regs->wr7p & M75_SCC_WR07P_EXT_READ;
+
+	switch( code ) {
+		case M75_SCC_REG_04:	/* else RR00 */
+			if( !ext )
+				return( FALSE );
+			*valP = regs->wr04;
+			break;
+		case M75_SCC_REG_05:	/* else RR01 */
+			if( !ext )
+				return( FALSE );
+			*valP = regs->wr05;
+			break;
+		case M75_SCC_REG_09:
+			*valP = ext ? regs->wr03 : regs->wr13;
+			break;
+		case M75_SCC_REG_11:
+			*valP = ext ? regs->wr10 : regs->wr15 & M75_SCC_RR15_MASK;
+			break;
+		case M75_SCC_REG_12:
+			*valP = regs->wr12;
+			break;
+		case M75_SCC_REG_13:
+			*valP = regs->wr13;
+			break;
+		case M75_BRGEN_TCONST:
+			*valP = (regs->wr13<<8) + regs->wr12;
+			break;
+		case M75_SCC_REG_14:	/* else RR10 */
+			if( !ext )
+				return( FALSE );
+			*valP = regs->wr7p;
+			break;
+		case M75_SCC_REG_15:
+			*valP = regs->wr15 & M75_SCC_RR15_MASK;
+			break;
+		default:
+			return( FALSE );
+	}
+	return( TRUE );
+}
+
 /****************************** M75_GetStat *********************************/
 /** Get the driver status
  *
@@ -1074,10 +1567,18 @@ static int32 M75_GetStat(
 
 	u_int32 retVal = 0, retVal1 = 0;
 	int32 error = ERR_SUCCESS;
+	OSS_IRQ_STATE irqState;
 
     DBGCMD( static const char functionName[] = "LL - M75_GetStat()"; )
     DBGWRT_1((DBH, "%s: ch=%d code=0x%04x\n", functionName, ch, code) );
 
+	/* write register read back, answer from mirror */
+	if( llHdl->chan[ch].regCached &&
+		M75_SccRegCached( llHdl, code, ch, &retVal ) ) {
+		*valueP = retVal;
+		return( ERR_SUCCESS );
+	}
+
     switch(code)
     {
         /*--------------------------+
@@ -1258,6 +1759,91 @@ static int32 M75_GetStat(
 		case M75_MAX_TXFRAME_NUM:
 			*valueP = llHdl->chan[ch].txQ.maxFrameNum;
 			break;
+		case M75_RX_DIRECT:
+			*valueP = llHdl->chan[ch].rxDirect;
+			break;
+		case M75_TX_DIRECT:
+			*valueP = llHdl->chan[ch].txDirect;
+			break;
+		case M75_RX_BATCH:
+			*valueP = llHdl->chan[ch].rxBatch;
+			break;
+		case M75_TX_BATCH:
+			*valueP = llHdl->chan[ch].txBatch;
+			break;
+		case M75_TX_BATCH_CNT:
+			*valueP = llHdl->chan[ch].txBatchCnt;
+			break;
+		case M75_RX_TSTAMP:
+			*valueP = llHdl->chan[ch].rxTstamp;
+			break;
+		case M75_REG_CACHED:
+			*valueP = llHdl->chan[ch].regCached;
+			break;
+		case M75_ASY_TX_FIFO:
+			*valueP = llHdl->chan[ch].asyTxFifo;
+			break;
+		case M75_ASY_RX_BURST:
+			*valueP = llHdl->chan[ch].asyRxBurst;
+			break;
+		case M75_ASY_RX_MARK:
+			*valueP = llHdl->chan[ch].asyRxSigWaterM;
+			break;
+		case M75_ASY_RX_IDLE:
+			*valueP = llHdl->chan[ch].asyRxIdle;
+			break;
+		case M75_RX_POLL_HI:
+			*valueP = llHdl->chan[ch].rxPollHi;
+			break;
+		case M75_RX_POLL_LO:
+			*valueP = llHdl->chan[ch].rxPollLo;
+			break;
+		case M75_RX_POLL_MSEC:
+			*valueP = llHdl->chan[ch].rxPollMsec;
+			break;
+		case M75_RX_POLL_MODE:
+			*valueP = llHdl->chan[ch].rxPolling;
+			break;
+		case M75_RX_DEFER:
+			*valueP = llHdl->chan[ch].rxDefer;
+			break;
+		case M75_RX_BUDGET:
+			*valueP = llHdl->chan[ch].rxBudget;
+			break;
+		case M75_RX_SIG_FRAMES:
+			*valueP = llHdl->chan[ch].rxSigFrames;
+			break;
+		case M75_RX_SIG_USEC:
+			*valueP = llHdl->chan[ch].rxSigUsec;
+			break;
+		case M75_STORM_LOOPS:
+			*valueP = llHdl->stormLoops;
+			break;
+		case M75_STORM_RATE:
+			*valueP = llHdl->stormRate;
+			break;
+		case M75_STORM_MSEC:
+			*valueP = llHdl->stormMsec;
+			break;
+		case M75_STORM_STATE:
+			*valueP = llHdl->chan[ch].stormMask;
+			break;
+		case M75_TX_ID:
+			*valueP = llHdl->chan[ch].txId;
+			break;
+		case M75_EV_MASK:
+			*valueP = llHdl->evMask;
+			break;
+		case M75_EV_STATE:
+			irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+			*valueP = M75_EvState( llHdl );
+			if( llHdl->evSig )
+				llHdl->evArmed = TRUE;
+			OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+			break;
+		case M75_TSTAMP_RATE:
+			*valueP = M75_TSTAMP_FREQ(llHdl);
+			break;
 		case M75_SCC_REGS:
 		{
 			M75_SCC_REGS_PB *sccp = (M75_SCC_REGS_PB *)blk->data;
@@ -1285,6 +1871,64 @@ static int32 M75_GetStat(
 
 			break;
 		}
+		case M75_BLK_STATS:
+		case M75_BLK_STATS_CLR:
+		{
+			if( blk->size != sizeof(M75_STATS) ){
+				DBGWRT_ERR((DBH, "*** ERR %s: wrong blk->size for M75_BLK_STATS\n", functionName));
+				error = ERR_LL_ILL_PARAM;
+				break;
+			}
+
+			/* consistent snapshot, ISR updates counters */
+			irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+			M75_RxModeTime( llHdl, ch );
+			OSS_MemCopy( llHdl->osHdl, sizeof(M75_STATS),
+						 (char*)&llHdl->chan[ch].stats, (char*)blk->data );
+			if( code == M75_BLK_STATS_CLR )
+				OSS_MemFill( llHdl->osHdl, sizeof(M75_STATS),
+							 (char*)&llHdl->chan[ch].stats, 0x00 );
+			OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+			break;
+		}
+		case M75_BLK_TX_DONE:
+		{
+			CHN_OBJ *chan = &llHdl->chan[ch];
+			M75_TX_DONE *done = (M75_TX_DONE*)blk->data;
+			u_int32 n = 0, max = blk->size / sizeof(M75_TX_DONE);
+
+			/* ISR puts completions */
+			irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+			while( n < max && chan->txDoneGet != chan->txDonePut ) {
+				done[n++] = chan->txDone[chan->txDoneGet % M75_TX_DONE_NUM];
+				chan->txDoneGet++;
+			}
+			OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+			blk->size = n * sizeof(M75_TX_DONE);
+			break;
+		}
+#ifdef M75_IRQ_STATS
+		case M75_BLK_IRQSTATS:
+		case M75_BLK_IRQSTATS_CLR:
+		{
+			if( blk->size != sizeof(M75_IRQSTATS) ){
+				DBGWRT_ERR((DBH, "*** ERR %s: wrong blk->size for M75_BLK_IRQSTATS\n", functionName));
+				error = ERR_LL_ILL_PARAM;
+				break;
+			}
+
+			irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+			OSS_MemCopy( llHdl->osHdl, sizeof(M75_IRQSTATS),
+						 (char*)&llHdl->irqStats, (char*)blk->data );
+			if( code == M75_BLK_IRQSTATS_CLR ) {
+				OSS_MemFill( llHdl->osHdl, sizeof(M75_IRQSTATS),
+							 (char*)&llHdl->irqStats, 0x00 );
+				llHdl->maxIrqTime = 0;
+			}
+			OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+			break;
+		}
+#endif /* M75_IRQ_STATS */
         /*--------------------------+
         |  (unknown)                |
         +--------------------------*/
@@ -1317,9 +1961,9 @@ static int32 M75_BlockRead(
 	MQUEUE_HEAD *rxQ = &llHdl->chan[ch].rxQ;
 	u_int32 n;
 	int32 error = 0;
-	u_int8 *frm;
 	OSS_IRQ_STATE irqState;
-	u_int8 irqMasked=0;
+	u_int8 direct=FALSE;
+	u_int32 tsSize;
     DBGCMD( static const char functionName[] = "LL - M75_BlockRead()"; )
 
     DBGWRT_1((DBH, "%s: ch=%d, size=%d\n", functionName, ch, size));
@@ -1331,35 +1975,36 @@ static int32 M75_BlockRead(
 	if( ch >= CH_NUMBER  || ch < 0)
 		return M75_ERR_CH_NUMBER;
 
-	if( size < (int32)rxQ->first->size )
-		return(M75_ERR_FRAMETOOLARGE);
-
-	irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
-	irqMasked++;
+	/* size of timestamp passed in front of frame */
+	tsSize = llHdl->chan[ch].rxTstamp ? sizeof(u_int32) : 0;
 
 	/* check if errors occured */
 	if( llHdl->chan[ch].rxERR ) {
-		int32 rxerror=llHdl->chan[ch].rxERR;
+		irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+		error = llHdl->chan[ch].rxERR;
 		llHdl->chan[ch].rxERR = 0;
 		rxQ->errSent = TRUE;
 		OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
-		return( rxerror );
+		if( error )
+			return( error );
 	}
 
 	/* check for read frames */
-	if( !rxQ->totEntries || !rxQ->first->ready || !rxQ->qinit ){
+	if( MQ_EMPTY(rxQ) || !rxQ->qinit ){
 		/* Rx buffer queue empty, or frame not completely passed yet */
+		irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
 
 		if( ( M75_SYNC_MODE != llHdl->chan[ch].syncMode ) && rxQ->last->xfering )
 		{
 			/* ASYNC mode:
 			 * Rx chars available in curent buffer, pass them to user */
-			rxQ->last->ready   = TRUE;
+			M75_STAT_RX( llHdl, ch, rxQ->last->size );
 			rxQ->last->xfering = FALSE;
-			rxQ->totEntries++;
-			rxQ->last = rxQ->last->next;
-
-			IDBGDMP_4((DBH, "LL - M75_BlockRead(), Rx Data:", llHdl->chan[ch].rxQ.last->frame, llHdl->chan[ch].rxQ.last->size, 1));
+			MQ_PUT(rxQ);
+			OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+		} else if( !MQ_EMPTY(rxQ) && rxQ->qinit ) {
+			/* frame received meanwhile */
+			OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
 		} else {
 			/* wait for data */
 			rxQ->waiting = TRUE; /* flag, waiting for sem */
@@ -1373,8 +2018,19 @@ static int32 M75_BlockRead(
 				return( M75_ERR_RX_QEMPTY );
 			}
 
+			/* offer buffer to ISR for direct delivery of next frame */
+			if( llHdl->chan[ch].rxDirect && !rxQ->directBuf &&
+				!llHdl->chan[ch].rxBatch &&
+				( M75_SYNC_MODE == llHdl->chan[ch].syncMode ) &&
+				( size > (int32)tsSize ) ) {
+				rxQ->directBuf  = (u_int8*)buf + tsSize;
+				rxQ->directSize = size - tsSize;
+				rxQ->directGot  = 0;
+				rxQ->directDone = FALSE;
+				direct = TRUE;
+			}
+
 			OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
-			irqMasked--;
 
 			while( error == 0 ) {
 				DBGWRT_3((DBH, "%s: Rx waiting\n", functionName));
@@ -1393,6 +2049,20 @@ static int32 M75_BlockRead(
 					 */
 					DBGWRT_3((DBH, "%s: Rx got sem\n", functionName));
 
+					/* frame already read into user buffer by ISR? */
+					if( direct && M75_RxDirectTake( llHdl, rxQ, nbrRdBytesP ) ) {
+						if( tsSize ) {
+							OSS_MemCopy( llHdl->osHdl, tsSize,
+										 (char*)&rxQ->directTstamp, (char*)buf );
+							*nbrRdBytesP += tsSize;
+						}
+						DBGWRT_3((DBH, "%s: passing %d bytes (direct)\n",
+								  functionName, *nbrRdBytesP));
+						return( ERR_SUCCESS );
+					}
+
+					irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+
 					/* check if errors occured */
 					if( llHdl->chan[ch].rxERR ) {
 						int32 rxerror=llHdl->chan[ch].rxERR;
@@ -1401,26 +2071,48 @@ static int32 M75_BlockRead(
 						OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
 						return( rxerror );
 					}
-					irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
-					irqMasked++;
 
 					if( ( M75_SYNC_MODE != llHdl->chan[ch].syncMode ) &&
-						( !rxQ->totEntries || !rxQ->first->ready )    &&
-						rxQ->last->xfering )
+						MQ_EMPTY(rxQ) && rxQ->last->xfering )
 					{
 						/* ASYNC mode, data available in unfinished queue entry only
 						 * pass this to user */
-						rxQ->last->ready   = TRUE;
+						M75_STAT_RX( llHdl, ch, rxQ->last->size );
 						rxQ->last->xfering = FALSE;
-						rxQ->totEntries++;
-						rxQ->last = rxQ->last->next;
-
-						IDBGDMP_4((DBH, "LL - M75_BlockRead(), Rx Data:", llHdl->chan[ch].rxQ.last->frame, llHdl->chan[ch].rxQ.last->size, 1));
+						MQ_PUT(rxQ);
 					}
+					OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
 
 					break;
 				}
 				else if( error ){
+					/* ASYNC mode: pass data below the water mark on timeout */
+					if( ( M75_SYNC_MODE != llHdl->chan[ch].syncMode ) &&
+						( error == ERR_OSS_TIMEOUT ) ) {
+						irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+						if( MQ_EMPTY(rxQ) && rxQ->last->xfering ) {
+							M75_STAT_RX( llHdl, ch, rxQ->last->size );
+							rxQ->last->xfering = FALSE;
+							MQ_PUT(rxQ);
+						}
+						if( !MQ_EMPTY(rxQ) ) {
+							rxQ->waiting = FALSE;
+							OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+							break;
+						}
+						OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+					}
+
+					/* frame may have been delivered while timing out */
+					if( direct && M75_RxDirectTake( llHdl, rxQ, nbrRdBytesP ) ) {
+						rxQ->waiting = FALSE;
+						if( tsSize ) {
+							OSS_MemCopy( llHdl->osHdl, tsSize,
+										 (char*)&rxQ->directTstamp, (char*)buf );
+							*nbrRdBytesP += tsSize;
+						}
+						return( ERR_SUCCESS );
+					}
 					rxQ->waiting = FALSE;
 					DBGWRT_ERR((DBH,"*** %s: error 0x%x waiting for data\n", functionName, error ));
 					*nbrRdBytesP = 0;
@@ -1432,40 +2124,143 @@ static int32 M75_BlockRead(
 		}
 	}
 
+	/* woken without data (e.g. queue not initialized) */
+	if( MQ_EMPTY(rxQ) )
+		return( M75_ERR_RX_QEMPTY );
+
 	/*----------------------+
 	|  Get frame from queue |
 	+----------------------*/
-	if( !irqMasked )
-		irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+	if( llHdl->chan[ch].rxBatch )
+		return( M75_RxBatch( llHdl, ch, (u_int8*)buf, size, nbrRdBytesP ) );
 
-	n = rxQ->first->size;
-	frm = (u_int8 *)buf;
+	/* entry was written by ISR before putCnt */
+	M75_MB();
 
-	OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
-
-	OSS_MemCopy(llHdl->osHdl, rxQ->first->size,
-				(char*)rxQ->first->frame,
-				(char*)buf );
+	n = rxQ->first->size;
+	if( size < (int32)(n + tsSize) )
+		return(M75_ERR_FRAMETOOLARGE);
 
-	irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+	if( tsSize )
+		OSS_MemCopy( llHdl->osHdl, tsSize, (char*)&rxQ->first->tstamp,
+					 (char*)buf );
+	OSS_MemCopy( llHdl->osHdl, n, (char*)rxQ->first->frame,
+				 (char*)buf + tsSize );
 
-	rxQ->totEntries--;
-	rxQ->errSent = FALSE;
-	rxQ->first->ready++;
+	IDBGDMP_4((DBH, "LL - M75_BlockRead(), Rx Data:", rxQ->first->frame, n, 1));
 
 	/* return nr of read bytes */
-	*nbrRdBytesP = rxQ->first->size;
+	*nbrRdBytesP = n + tsSize;
 	rxQ->first->size = 0;
+	rxQ->errSent = FALSE;
 
-	rxQ->first = rxQ->first->next;
-
-	OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+	/* return entry to ISR, no locking required */
+	MQ_GET(rxQ);
 
 	DBGWRT_3((DBH, "%s: passing %d bytes\n", functionName, *nbrRdBytesP));
 
 	return(ERR_SUCCESS);
 } /* M75_BlockRead */
 
+/******************************** M75_RxBatch *******************************/
+/** Pass as many frames from the Rx queue as fit into the user buffer
+ *
+ *  Every frame is stored as record: M75_RX_REC_HDR followed by the frame
+ *  data, padded to M75_RX_REC_SIZE(). Called by M75_BlockRead when at least
+ *  one frame is ready.
+ *
+ *  \param llHdl       \IN  low-level handle
+ *  \param ch          \IN  current channel
+ *  \param buf         \IN  data buffer
+ *  \param size        \IN  data buffer size
+ *  \param nbrRdBytesP \OUT number of bytes stored in buffer
+ *
+ *  \return            \c 0 on success or error code
+ */
+static int32 M75_RxBatch(
+	LL_HANDLE *llHdl,
+	int32 ch,
+	u_int8 *buf,
+	int32 size,
+	int32 *nbrRdBytesP
+)
+{
+	MQUEUE_HEAD *rxQ = &llHdl->chan[ch].rxQ;
+	M75_RX_REC_HDR *hdr = NULL;
+	u_int32 n, recSize, got = 0;
+    DBGCMD( static const char functionName[] = "LL - M75_RxBatch()"; )
+
+	/* at least the first frame must fit */
+	M75_MB();
+	if( size < (int32)M75_RX_REC_SIZE(rxQ->first->size) )
+		return(M75_ERR_FRAMETOOLARGE);
+
+	while( !MQ_EMPTY(rxQ) ) {
+		/* entry was written by ISR before putCnt */
+		M75_MB();
+
+		n = rxQ->first->size;
+		recSize = M75_RX_REC_SIZE(n);
+		if( got + recSize > (u_int32)size )
+			break;	/* buffer full */
+
+		hdr = (M75_RX_REC_HDR*)(buf + got);
+		hdr->size   = (u_int16)n;
+		hdr->flags  = 0;
+		hdr->tstamp = rxQ->first->tstamp;
+		OSS_MemCopy( llHdl->osHdl, n, (char*)rxQ->first->frame,
+					 (char*)(hdr + 1) );
+		got += recSize;
+
+		rxQ->first->size = 0;
+		MQ_GET(rxQ);
+	}
+	rxQ->errSent = FALSE;
+
+	/* tell application that the next call returns an error */
+	if( hdr && llHdl->chan[ch].rxERR )
+		hdr->flags |= M75_RXREC_ERR_PENDING;
+
+	*nbrRdBytesP = got;
+	DBGWRT_3((DBH, "%s: passing %d bytes\n", functionName, got));
+
+	return( ERR_SUCCESS );
+} /* M75_RxBatch */
+
+/***************************** M75_RxDirectTake ****************************/
+/** Withdraw a buffer offered for direct Rx delivery
+ *
+ *  Called by M75_BlockRead after waiting for data. Removes the buffer from
+ *  the Rx queue header and checks if the ISR has read a frame into it.
+ *
+ *  \param llHdl       \IN  low-level handle
+ *  \param rxQ         \IN  Rx queue header
+ *  \param nbrRdBytesP \OUT number of bytes delivered into the buffer
+ *
+ *  \return            TRUE if a frame was delivered, otherwise FALSE
+ */
+static int32 M75_RxDirectTake(
+	LL_HANDLE *llHdl,
+	MQUEUE_HEAD *rxQ,
+	int32 *nbrRdBytesP
+)
+{
+	OSS_IRQ_STATE irqState;
+	int32 got = FALSE;
+
+	irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+	rxQ->directBuf = NULL;
+	if( rxQ->directDone ) {
+		rxQ->directDone = FALSE;
+		rxQ->errSent = FALSE;
+		*nbrRdBytesP = rxQ->directGot;
+		got = TRUE;
+	}
+	OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+
+	return( got );
+} /* M75_RxDirectTake */
+
 /****************************** M75_BlockWrite *****************************/
 /** Write a data block to the device
  *
@@ -1496,17 +2291,46 @@ static int32 M75_BlockWrite(
 		goto ERR_ABORT;
 	}
 
-	if( (u_int32)size > llHdl->chan[ch].txQ.maxFrameSize ) {
+	if( !llHdl->chan[ch].txBatch &&
+		(u_int32)size > llHdl->chan[ch].txQ.maxFrameSize ) {
 		error = M75_ERR_FRAMETOOLARGE;
 		goto ERR_ABORT;
 	}
 
+	/* transmitter idle and queue empty: send straight from user buffer */
+	if( llHdl->chan[ch].txDirect && !llHdl->chan[ch].txBatch &&
+		( M75_SYNC_MODE == llHdl->chan[ch].syncMode ) ) {
+
+		irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+		if( MQ_EMPTY(&llHdl->chan[ch].txQ) &&
+			llHdl->chan[ch].txQ.qinit &&
+			M75_TxClaim_Sync( llHdl, ch ) ) {
+			/* transmitter claimed, next frame is started by EOM interrupt */
+			M75_TxWire_Sync( llHdl, ch, ++llHdl->chan[ch].txId,
+							 M75_TSTAMP_GET(llHdl) );
+			OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+
+			DBGWRT_3((DBH, "   %s: Tx direct\n", functionName));
+			M75_TxStart_Sync( llHdl, ch, (u_int8*)buf, (u_int32)size );
+
+			irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+			M75_STAT_TX( llHdl, ch, (u_int32)size );
+			OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+
+			*nbrWrBytesP = size;
+			return( ERR_SUCCESS );
+		}
+		OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+	}
+
 	/* check for queue space */
 
-	if ( (llHdl->chan[ch].txQ.totEntries == llHdl->chan[ch].txQ.maxFrameNum) ||
-		  !llHdl->chan[ch].txQ.qinit){
+	if ( MQ_FULL(&llHdl->chan[ch].txQ) || !llHdl->chan[ch].txQ.qinit){
 
 		DBGWRT_2((DBH, "   %s: Tx buffer queue full\n", functionName));
+		irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+		llHdl->chan[ch].stats.txQFull++;
+		OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
 
 		/* Tx buffer queue full */
 		if( llHdl->chan[ch].setBlockTout == 0 ) {
@@ -1521,6 +2345,13 @@ static int32 M75_BlockWrite(
 
 			llHdl->chan[ch].txQ.waiting = TRUE; /* flag, waiting for sem */
 
+			/* entry may have been freed before ISR could see the flag */
+			M75_MB();
+			if( !MQ_FULL(&llHdl->chan[ch].txQ) && llHdl->chan[ch].txQ.qinit ) {
+				llHdl->chan[ch].txQ.waiting = FALSE;
+				break;
+			}
+
 			DEVSEM_UNLOCK( llHdl );
 
 			/* wait for FIFO space */
@@ -1546,23 +2377,32 @@ static int32 M75_BlockWrite(
 		}
 	}
 
+	if( llHdl->chan[ch].txBatch ) {
+		/* put all frames which fit into queue */
+		error = M75_TxBatch( llHdl, ch, (u_int8*)buf, size, nbrWrBytesP );
+		if( error )
+			goto ERR_ABORT;
+
+		/* try to send data/frame */
+		error = M75_Tx(llHdl,ch);
+		goto ERR_ABORT;
+	}
+
 	/* put frame into queue */
 	OSS_MemCopy(llHdl->osHdl, size, (char*)buf,
 				(char*)llHdl->chan[ch].txQ.last->frame );
 
-	irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
-
 	llHdl->chan[ch].txQ.last->size = size;
 	llHdl->chan[ch].txQ.last->xfering = 0;
-	llHdl->chan[ch].txQ.last->ready = 1;
-	llHdl->chan[ch].txQ.totEntries++;
-	llHdl->chan[ch].txQ.last = llHdl->chan[ch].txQ.last->next;
+	llHdl->chan[ch].txQ.last->id = ++llHdl->chan[ch].txId;
+	llHdl->chan[ch].txQ.last->tstamp = M75_TSTAMP_GET(llHdl);
+
+	/* pass entry to ISR, no locking required */
+	MQ_PUT(&llHdl->chan[ch].txQ);
 
 	/* return number of written bytes */
 	*nbrWrBytesP = size;
 
-	OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
-
 	/* try to send data/frame */
 	error = M75_Tx(llHdl,ch);
 
@@ -1570,6 +2410,80 @@ ERR_ABORT:
 	return(error);
 } /* M75_BlockWrite */
 
+/******************************** M75_TxBatch *******************************/
+/** Put the frames of a M75_TX_BATCH buffer into the Tx queue
+ *
+ *  The frames are copied into the free queue entries first and then
+ *  passed to the ISR with one update of the producer counter. Copying stops when the
+ *  queue is full, at the end of the buffer or at a record with size 0.
+ *
+ *  \param llHdl       \IN  low-level handle
+ *  \param ch          \IN  current channel
+ *  \param buf         \IN  data buffer with M75_TX_REC_HDR records
+ *  \param size        \IN  data buffer size
+ *  \param nbrWrBytesP \OUT number of bytes of the records accepted
+ *
+ *  \return            \c 0 on success or error code if the first record
+ *                     is invalid
+ */
+static int32 M75_TxBatch(
+	LL_HANDLE *llHdl,
+	int32 ch,
+	u_int8 *buf,
+	int32 size,
+	int32 *nbrWrBytesP
+)
+{
+	MQUEUE_HEAD *txQ = &llHdl->chan[ch].txQ;
+	MQUEUE_ENT *ent = txQ->last;
+	M75_TX_REC_HDR *hdr;
+	u_int32 freeEnt, n = 0, got = 0, recSize;
+    DBGCMD( static const char functionName[] = "LL - M75_TxBatch()"; )
+
+	/* ISR only frees entries, so the number can only grow meanwhile */
+	freeEnt = txQ->maxFrameNum - MQ_CNT(txQ);
+
+	while( n < freeEnt && got + sizeof(M75_TX_REC_HDR) <= (u_int32)size ) {
+		hdr = (M75_TX_REC_HDR*)(buf + got);
+		if( hdr->size == 0 )
+			break;	/* end of sequence */
+
+		if( hdr->size > txQ->maxFrameSize ||
+			got + sizeof(M75_TX_REC_HDR) + hdr->size > (u_int32)size ) {
+			DBGWRT_ERR((DBH, "*** %s: invalid record at offset %d\n",
+						functionName, got ));
+			if( n == 0 )
+				return( hdr->size > txQ->maxFrameSize ?
+						M75_ERR_FRAMETOOLARGE : ERR_LL_ILL_PARAM );
+			break;
+		}
+
+		/* entry not yet passed to ISR, no locking required */
+		OSS_MemCopy( llHdl->osHdl, hdr->size, (char*)(hdr + 1),
+					 (char*)ent->frame );
+		ent->size    = hdr->size;
+		ent->xfering = 0;
+		ent->id      = ++llHdl->chan[ch].txId;
+		ent->tstamp  = M75_TSTAMP_GET(llHdl);
+		ent = ent->next;
+		n++;
+
+		recSize = M75_TX_REC_SIZE(hdr->size);
+		got = ( got + recSize > (u_int32)size ) ? (u_int32)size : got + recSize;
+	}
+
+	/* publish all frames at once */
+	M75_MB();
+	txQ->last = ent;
+	txQ->putCnt += n;
+
+	llHdl->chan[ch].txBatchCnt = n;
+	*nbrWrBytesP = got;
+	DBGWRT_3((DBH, "%s: %d frames, %d bytes queued\n", functionName, n, got));
+
+	return( ERR_SUCCESS );
+} /* M75_TxBatch */
+
 /****************************** M75_TxFrame **********************************/
 /** Transfer a frame from the Tx queue to the Tx FIFO.
  *  Enable transmitter and FIFO.
@@ -1589,6 +2503,8 @@ static int32 M75_Tx(
 
 	if( M75_SYNC_MODE == llHdl->chan[ch].syncMode ) {
 		error = M75_TxFrame_Sync( llHdl,ch);
+	} else if( llHdl->chan[ch].asyTxFifo ) {
+		error = M75_TxFifo_Async( llHdl,ch);
 	} else {
 		error = M75_TxData_Async( llHdl,ch);
 	}
@@ -1602,6 +2518,11 @@ static int32 M75_Tx(
 /** Transfer a frame from the Tx queue to the Tx FIFO in synchronous mode.
  *  Enable transmitter and FIFO.
  *
+ *  Called by M75_BlockWrite() and by the Tx Underrun/EOM interrupt. The
+ *  frame is loaded as soon as the SCC sends CRC and closing flag of the
+ *  previous one (see M75_TxClaim_Sync()), so back-to-back frames are only
+ *  separated by the closing/opening flags.
+ *
  *  \param llHdl  	   \IN  low-level handle
  *  \param ch          \IN  current channel
  *
@@ -1614,46 +2535,37 @@ static int32 M75_TxFrame_Sync(
 {
 	MQUEUE_HEAD *qHead = &llHdl->chan[ch].txQ;
 	OSS_IRQ_STATE irqState;
-	u_int8 retVal;
+	u_int32 size;
     DBGCMD( static const char functionName[] = "LL - M75_Tx (SYNC)"; )
 
-	IDBGWRT_2((DBH, "   >>> %s: ch=%d; totEntries=%d\n", functionName, ch, qHead->totEntries));
+	IDBGWRT_2((DBH, "   >>> %s: ch=%d; entries=%d\n", functionName, ch, MQ_CNT(qHead)));
 
 	irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
 
-	if( !llHdl->chan[ch].txUnderrEOMgot ) {
-		/* read status of external FIFO */
-		retVal = MREAD_D8( llHdl->ma, FIFO_STATREG_A+(ch<<1) );
-		if( retVal & M75_FIFO_STATREG_TXFIFO_EMPTY ) {	/* external Tx FIFO is empty */
-			/* eventually allow CRC to be transmitted */
-			OSS_MikroDelay(llHdl->osHdl, 5);
-			llHdl->chan[ch].txUnderrEOMgot = 1;
-		}
-	}
+	if( !MQ_EMPTY(qHead) &&					/* frame in queue */
+		qHead->qinit &&
+		M75_TxClaim_Sync( llHdl, ch ) ){	/* previous frame completed */
 
-	if( llHdl->chan[ch].txUnderrEOMgot &&	/* TxUnderr/EOM interrupt got */
-		qHead->totEntries &&				/* frame in queue */
-		qHead->first->ready &&				/* frame is ready to be sent */
-		qHead->qinit ){
+		/* entry was written by BlockWrite before putCnt */
+		M75_MB();
+		M75_TxWire_Sync( llHdl, ch, qHead->first->id, qHead->first->tstamp );
 
-		/* set frame inactive so if interrupted by ISR, *
+		/* transmitter claimed, so if interrupted by ISR, *
 		 * this frame is not sent twice */
-		qHead->first->ready = 0;
-		llHdl->chan[ch].txUnderrEOMgot = 0;
-
 		OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
 
+		size = qHead->first->size;
 		IDBGWRT_2((DBH, "    %s: frame %4d; size=0x%04X\n",
-						functionName, qHead->first->frame[0], qHead->first->size));
+						functionName, qHead->first->frame[0], size));
 
-		/* enable Tx */
-		WRITE_SCC_REG( llHdl->ma, ch, M75_R05, llHdl->chan[ch].sccRegs.wr05 | M75_SCC_WR05_TX_EN );
+		M75_TxStart_Sync( llHdl, ch, qHead->first->frame, size );
 
-		MFIFO_WRITE_D8( llHdl->ma, (FIFO_REG_A+(ch<<1)), qHead->first->size, qHead->first->frame );
+		/* delete frame from queue, owner of transmitter is only consumer */
+		MQ_GET(qHead);
 
-		/* enable Tx FIFO */
-		/* when this bit is set the data is transferred from the FIFO to the transmit buffer */
-		MWRITE_D8( llHdl->ma, FIFO_STATREG_A+(ch<<1), M75_FIFO_STATREG_TXEN );
+		irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+		M75_STAT_TX( llHdl, ch, size );
+		OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
 
 		/* send semaphore if BlockWrite is waiting for free buffer space */
 		if( qHead->waiting ) {
@@ -1661,22 +2573,443 @@ static int32 M75_TxFrame_Sync(
 			qHead->waiting = FALSE;
 			OSS_SemSignal( llHdl->osHdl, qHead->sem );
 		}
-
-		/* delete frame from queue */
-		irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
-		qHead->first = qHead->first->next;
-		qHead->totEntries--;
-		OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
 	} else {
-		IDBGWRT_3((DBH, "    %s (not sent): txUnderrEOMgot=%d; totEntries=%d; ready=%d; qinit=%d\n",
-						functionName, llHdl->chan[ch].txUnderrEOMgot, qHead->totEntries, qHead->first->ready, qHead->qinit));
+		OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+		IDBGWRT_3((DBH, "    %s (not sent): txUnderrEOMgot=%d; entries=%d; qinit=%d\n",
+						functionName, llHdl->chan[ch].txUnderrEOMgot, MQ_CNT(qHead), qHead->qinit));
 	}
-	OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
 
 	IDBGWRT_2((DBH, "   <<< %s\n", functionName));
 	return(ERR_SUCCESS);
 } /* M75_TxFrame_Sync */
 
+/****************************** M75_TxClaim_Sync *****************************/
+/** Claim the transmitter of a SYNC channel for the next frame
+ *
+ *  The transmitter is free when the Tx Underrun/EOM interrupt was got or,
+ *  before the ISR has seen it, when RR00 shows the Tx Underrun/EOM latch
+ *  set: the SCC sends CRC and closing flag of the previous frame, a frame
+ *  loaded now follows right after. No need to wait for the CRC.
+ *  The latch is reset and txEomClaimed set: the Z85230 freezes RR00 while
+ *  the Ext/Status interrupt for this EOM is pending, so M75_IrqExtStat()
+ *  still sees the EOM and must not complete the frame or start a further
+ *  one. The Tx FIFO is disabled until the frame is loaded completely.
+ *  Must be called with IRQs masked.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch          \IN  current channel
+ *
+ *  \return            TRUE if claimed, FALSE if a frame is in progress
+ */
+static u_int8 M75_TxClaim_Sync(
+	LL_HANDLE *llHdl,
+	int32 ch
+)
+{
+	u_int32 rr0 = 0;
+
+	if( !llHdl->chan[ch].txUnderrEOMgot ) {
+		IREAD_SCC_REG( llHdl->ma, ch, M75_R00, rr0 );
+		if( !(rr0 & M75_SCC_RR00_TX_UNDR_EOM) )
+			return( FALSE );
+		M75_TxDone( llHdl, ch );
+		llHdl->chan[ch].txEomClaimed = TRUE;
+	}
+
+	llHdl->chan[ch].txUnderrEOMgot = 0;
+	IWRITE_SCC_CMD( llHdl->ma, ch, M75_SCC_WR00_RST_UNDERR_EOM );
+	MWRITE_D8( llHdl->ma, FIFO_STATREG_A+(ch<<1), 0x00 );
+	return( TRUE );
+} /* M75_TxClaim_Sync */
+
+/****************************** M75_TxWire_Sync ******************************/
+/** Record the frame the claimed transmitter sends next
+ *
+ *  Called with IRQs masked right after M75_TxClaim_Sync() succeeded, so
+ *  M75_TxDone() never sees the fields half-updated. The completion is
+ *  reported with the EOM of this frame, no EOM comes before the frame is
+ *  loaded by M75_TxStart_Sync().
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch          \IN  current channel
+ *  \param id          \IN  frame id (M75_TX_ID)
+ *  \param tQueued     \IN  time frame was queued (timestamp)
+ */
+static void M75_TxWire_Sync(
+	LL_HANDLE *llHdl,
+	int32 ch,
+	u_int32 id,
+	u_int32 tQueued
+)
+{
+	llHdl->chan[ch].txWireId = id;
+	llHdl->chan[ch].txWireQ  = tQueued;
+	llHdl->chan[ch].txOnWire = TRUE;
+} /* M75_TxWire_Sync */
+
+/****************************** M75_TxStart_Sync *****************************/
+/** Load one frame into the external Tx FIFO and start transmission.
+ *
+ *  The caller must own the transmitter, i.e. M75_TxClaim_Sync() and
+ *  M75_TxWire_Sync() were called while interrupts were masked, and counts
+ *  the frame in the statistics once it is loaded.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch          \IN  current channel
+ *  \param frame       \IN  frame data
+ *  \param size        \IN  frame size (bytes)
+ */
+static void M75_TxStart_Sync(
+	LL_HANDLE *llHdl,
+	int32 ch,
+	u_int8 *frame,
+	u_int32 size
+)
+{
+	/* enable Tx */
+	WRITE_SCC_REG( llHdl->ma, ch, M75_R05, llHdl->chan[ch].sccRegs.wr05 | M75_SCC_WR05_TX_EN );
+
+	MFIFO_WRITE_D8( llHdl->ma, (FIFO_REG_A+(ch<<1)), size, frame );
+
+	/* enable Tx FIFO */
+	/* when this bit is set the data is transferred from the FIFO to the transmit buffer */
+	MWRITE_D8( llHdl->ma, FIFO_STATREG_A+(ch<<1), M75_FIFO_STATREG_TXEN );
+} /* M75_TxStart_Sync */
+
+/****************************** M75_TxDone ***********************************/
+/** Record the completion of the frame being sent in SYNC mode
+ *
+ *  Called with the Tx Underrun/EOM of the frame, from the ISR or with
+ *  IRQs masked. When the list is full, the oldest completion is dropped.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch          \IN  current channel
+ */
+static void M75_TxDone(
+	LL_HANDLE *llHdl,
+	int32 ch
+)
+{
+	CHN_OBJ *chan = &llHdl->chan[ch];
+	M75_TX_DONE *done;
+
+	if( !chan->txOnWire )
+		return;
+	chan->txOnWire = FALSE;
+
+	if( chan->txDonePut - chan->txDoneGet >= M75_TX_DONE_NUM ) {
+		chan->txDoneGet++;
+		chan->stats.txDoneLost++;
+	}
+	done = &chan->txDone[chan->txDonePut % M75_TX_DONE_NUM];
+	done->id      = chan->txWireId;
+	done->tQueued = chan->txWireQ;
+	done->tDone   = M75_TSTAMP_GET(llHdl);
+	chan->txDonePut++;
+
+	if( chan->txSig )
+		OSS_SigSend( llHdl->osHdl, chan->txSig );
+} /* M75_TxDone */
+
+/****************************** M75_Wait *************************************/
+/** Wait until a check succeeds, woken by a semaphore (M75_TX_DRAIN/EV_WAIT)
+ *
+ *  \a check runs with IRQs masked. If it fails, *waitP is set so the ISR
+ *  or an alarm signals \a sem when the state changes, and DEVSEM is
+ *  released while waiting. *waitP is cleared on return.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch          \IN  current channel, passed to \a check
+ *  \param tout        \IN  timeout (msec), 0: check only, -1: endless
+ *  \param sem         \IN  semaphore signalled by the waker
+ *  \param waitP       \IN  waiter flag checked by the waker
+ *  \param check       \IN  check routine
+ *
+ *  \return            \c 0 when done or error code
+ */
+static int32 M75_Wait(
+	LL_HANDLE *llHdl,
+	int32 ch,
+	int32 tout,
+	OSS_SEM_HANDLE *sem,
+	u_int8 *waitP,
+	M75_WAIT_CHECK check
+)
+{
+	u_int32 start = M75_TSTAMP_GET(llHdl), left, poll;
+	int32 wait, error = ERR_SUCCESS;
+	u_int8 done;
+	OSS_IRQ_STATE irqState;
+
+	for(;;) {
+		poll = 0;
+		irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+		done = check( llHdl, ch, &poll );
+		*waitP = !done;
+		OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+		if( done )
+			break;
+
+		/* time left */
+		if( tout < 0 )
+			wait = OSS_SEM_WAITFOREVER;
+		else {
+			if( !(left = M75_MsecLeft( llHdl, start, (u_int32)tout )) ) {
+				error = ERR_OSS_TIMEOUT;
+				break;
+			}
+			wait = (int32)left;
+		}
+		if( poll && (wait < 0 || (u_int32)wait > poll) )
+			wait = (int32)poll;
+
+		DEVSEM_UNLOCK( llHdl );
+		error = OSS_SemWait( llHdl->osHdl, sem, wait );
+		DEVSEM_LOCK( llHdl );
+
+		if( error && error != ERR_OSS_TIMEOUT )
+			break;
+		error = ERR_SUCCESS;
+	}
+
+	irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+	*waitP = FALSE;
+	OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+	return( error );
+} /* M75_Wait */
+
+/****************************** M75_TxDrain **********************************/
+/** Wait until all frames of the channel have been sent (M75_TX_DRAIN)
+ *
+ *  Done when the Tx queue and the external Tx FIFO are empty and the SCC
+ *  has finished: SYNC mode Tx Underrun/EOM of the last frame, ASYNC mode
+ *  All Sent. The waiter is woken by the EOM interrupt or when the Tx queue
+ *  gets empty. All Sent raises no interrupt, so in ASYNC mode the state is
+ *  then checked every two character times (see M75_TxDrainCheck()).
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch          \IN  current channel
+ *  \param tout        \IN  timeout (msec), 0: check only, -1: endless
+ *
+ *  \return            \c 0 when drained or error code
+ */
+static int32 M75_TxDrain(
+	LL_HANDLE *llHdl,
+	int32 ch,
+	int32 tout
+)
+{
+	int32 error;
+    DBGCMD( static const char functionName[] = "LL - M75_TxDrain"; )
+
+	error = M75_Wait( llHdl, ch, tout, llHdl->chan[ch].txDrainSem,
+					  &llHdl->chan[ch].txDrainWait, M75_TxDrainCheck );
+
+	DBGWRT_2((DBH, "%s: ch=%d, error=0x%x\n", functionName, ch, error));
+	return( error );
+} /* M75_TxDrain */
+
+/****************************** M75_TxDrainCheck *****************************/
+/** M75_Wait() check for M75_TxDrain()
+ *
+ *  In ASYNC mode with the Tx queue empty, the last characters leave the
+ *  SCC without an interrupt: poll every two character times. In SYNC mode
+ *  the EOM interrupt of the last frame wakes the waiter.
+ *  Must be called with IRQs masked.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch          \IN  current channel
+ *  \param pollP       \OUT max. wait (msec), 0: until woken
+ *
+ *  \return            TRUE if all frames have been sent
+ */
+static u_int8 M75_TxDrainCheck(
+	LL_HANDLE *llHdl,
+	int32 ch,
+	u_int32 *pollP
+)
+{
+	if( M75_TxIdle( llHdl, ch ) )
+		return( TRUE );
+
+	if( M75_SYNC_MODE != llHdl->chan[ch].syncMode &&
+		MQ_EMPTY(&llHdl->chan[ch].txQ) )
+		*pollP = M75_TxFifoMsec( llHdl, ch, 2 );
+	return( FALSE );
+} /* M75_TxDrainCheck */
+
+/****************************** M75_TxIdle ***********************************/
+/** Check if all frames of the channel have been sent
+ *
+ *  Must be called with IRQs masked.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch          \IN  current channel
+ *
+ *  \return            TRUE if Tx queue, Tx FIFO and SCC are empty
+ */
+static u_int8 M75_TxIdle(
+	LL_HANDLE *llHdl,
+	int32 ch
+)
+{
+	u_int32 rr = 0;
+
+	if( !MQ_EMPTY(&llHdl->chan[ch].txQ) )
+		return( FALSE );
+	if( !(MREAD_D8( llHdl->ma, FIFO_STATREG_A+(ch<<1) ) &
+		  M75_FIFO_STATREG_TXFIFO_EMPTY) )
+		return( FALSE );
+
+	if( M75_SYNC_MODE == llHdl->chan[ch].syncMode ) {
+		/* RR01 would advance the status FIFO, use the EOM latch */
+		if( llHdl->chan[ch].txUnderrEOMgot )
+			return( TRUE );
+		IREAD_SCC_REG( llHdl->ma, ch, M75_R00, rr );
+		return( (rr & M75_SCC_RR00_TX_UNDR_EOM) ? TRUE : FALSE );
+	}
+
+	IREAD_SCC_REG( llHdl->ma, ch, M75_R01, rr );
+	return( (rr & M75_SCC_RR01_ALL_SENT) ? TRUE : FALSE );
+} /* M75_TxIdle */
+
+/****************************** M75_TxDrainWake ******************************/
+/** Wake a M75_TxDrain() waiter to check the Tx state again
+ *
+ *  Called from the ISR or with IRQs masked.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch          \IN  current channel
+ */
+static void M75_TxDrainWake(
+	LL_HANDLE *llHdl,
+	int32 ch
+)
+{
+	if( llHdl->chan[ch].txDrainWait ) {
+		llHdl->chan[ch].txDrainWait = FALSE;
+		OSS_SemSignal( llHdl->osHdl, llHdl->chan[ch].txDrainSem );
+	}
+} /* M75_TxDrainWake */
+
+/****************************** M75_EvState **********************************/
+/** Get the ready events of interest of both channels (M75_EV_STATE)
+ *
+ *  Must be called with IRQs masked or from the ISR.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *
+ *  \return            M75_EV_CH() bits, masked with M75_EV_MASK
+ */
+static u_int32 M75_EvState(
+	LL_HANDLE *llHdl
+)
+{
+	CHN_OBJ *chan;
+	u_int32 ch, ev = 0;
+
+	for( ch=0; ch<CH_NUMBER; ch++ ) {
+		chan = &llHdl->chan[ch];
+
+		/* same conditions that let M_getblock/M_setblock return at once */
+		if( chan->rxQ.qinit &&
+			( !MQ_EMPTY(&chan->rxQ) ||
+			  ( M75_SYNC_MODE != chan->syncMode &&
+				chan->rxQ.last->xfering && chan->asyRxWoke ) ) )
+			ev |= M75_EV_CH( ch, M75_EV_RX );
+		if( chan->txQ.qinit && !MQ_FULL(&chan->txQ) )
+			ev |= M75_EV_CH( ch, M75_EV_TX );
+		if( chan->rxERR )
+			ev |= M75_EV_CH( ch, M75_EV_ERR );
+	}
+
+	return( ev & llHdl->evMask );
+} /* M75_EvState */
+
+/****************************** M75_EvCheck **********************************/
+/** Wake the M75_EV_WAIT waiter and send the readiness signal if ready
+ *
+ *  Called at the end of the ISR and the alarm routines, with IRQs masked.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ */
+static void M75_EvCheck(
+	LL_HANDLE *llHdl
+)
+{
+	if( !llHdl->evWait && !llHdl->evArmed )
+		return;
+	if( !M75_EvState( llHdl ) )
+		return;
+
+	if( llHdl->evWait ) {
+		llHdl->evWait = FALSE;
+		OSS_SemSignal( llHdl->osHdl, llHdl->evSem );
+	}
+	if( llHdl->evArmed ) {
+		llHdl->evArmed = FALSE;
+		OSS_SigSend( llHdl->osHdl, llHdl->evSig );
+	}
+} /* M75_EvCheck */
+
+/****************************** M75_EvWait ***********************************/
+/** Wait until an event of interest of any channel is ready (M75_EV_WAIT)
+ *
+ *  evSem and evWait are device wide, so only one thread may wait at a
+ *  time. A second caller gets ERR_OSS_BUSY_RESOURCE while the first one
+ *  still waits (DEVSEM is released during the wait).
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param tout        \IN  timeout (msec), 0: check only, -1: endless
+ *
+ *  \return            \c 0 when ready or error code
+ */
+static int32 M75_EvWait(
+	LL_HANDLE *llHdl,
+	int32 tout
+)
+{
+	int32 error;
+    DBGCMD( static const char functionName[] = "LL - M75_EvWait"; )
+
+	/* DEVSEM held here, evBusy is only touched under DEVSEM */
+	if( llHdl->evBusy ) {
+		DBGWRT_ERR((DBH, "*** %s: another thread waits already\n",
+					functionName));
+		return( ERR_OSS_BUSY_RESOURCE );
+	}
+	llHdl->evBusy = TRUE;
+
+	error = M75_Wait( llHdl, 0, tout, llHdl->evSem, &llHdl->evWait,
+					  M75_EvCheckWait );
+
+	llHdl->evBusy = FALSE;
+	DBGWRT_2((DBH, "%s: error=0x%x\n", functionName, error));
+	return( error );
+} /* M75_EvWait */
+
+/****************************** M75_EvCheckWait ******************************/
+/** M75_Wait() check for M75_EvWait()
+ *
+ *  Must be called with IRQs masked.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch          \IN  unused, events of both channels are checked
+ *  \param pollP       \OUT unchanged, M75_EvCheck() wakes the waiter
+ *
+ *  \return            TRUE if an event of interest is ready
+ */
+static u_int8 M75_EvCheckWait(
+	LL_HANDLE *llHdl,
+	int32 ch,
+	u_int32 *pollP
+)
+{
+	(void)ch;
+	(void)pollP;
+	return( M75_EvState( llHdl ) ? TRUE : FALSE );
+} /* M75_EvCheckWait */
+
 /****************************** M75_TxData_Async *****************************/
 /** Transfer data from the Tx queue to the Data Reg in async/IRQ mode.
  *
@@ -1694,13 +3027,14 @@ static int32 M75_TxData_Async(
 	OSS_IRQ_STATE irqState;
     DBGCMD( static const char functionName[] = "LL - M75_Tx (ASYNC)"; )
 
-	IDBGWRT_2((DBH, "   >>> %s: ch=%d; totEntries=%d\n", functionName, ch, qHead->totEntries));
+	IDBGWRT_2((DBH, "   >>> %s: ch=%d; entries=%d\n", functionName, ch, MQ_CNT(qHead)));
 
 	irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+	M75_MB();
 
 	if( llHdl->chan[ch].txBufEmpty &&	/* Tx buffer empty interrupt got */
 		qHead->qinit &&					/* Tx Queue initialized */
-		qHead->totEntries &&			/* frame in queue */
+		!MQ_EMPTY(qHead) &&				/* frame in queue */
 		qHead->first->xfering )			/* frame is beeing processed */
 	{
 		IDBGWRT_2((DBH, "   >>> %s: processing active frame (send byte %d)\n", functionName, qHead->first->xfering));
@@ -1713,11 +3047,12 @@ static int32 M75_TxData_Async(
 		if( qHead->first->xfering == qHead->first->size ) {
 			/* frame sent completely
 			 * mark queue entry as empty, move on to next frame if available */
+			M75_STAT_TX( llHdl, ch, qHead->first->size );
 			qHead->first->xfering = 0;
-			qHead->first->ready   = 0;
-			qHead->first = qHead->first->next;
-			qHead->totEntries--;
+			MQ_GET(qHead);
 			IDBGWRT_3((DBH, "   >>> %s: return finished queue entry to queue\n", functionName));
+			if( MQ_EMPTY(qHead) )
+				M75_TxDrainWake( llHdl, ch );
 
 			/* send semaphore if BlockWrite is waiting for free buffer space */
 			if( qHead->waiting ) {
@@ -1730,13 +3065,11 @@ static int32 M75_TxData_Async(
 		}
 	} else if( llHdl->chan[ch].txBufEmpty && /* TxUnderr/EOM interrupt got */
 			   qHead->qinit &&				 /* Tx Queue initialized */
-			   qHead->totEntries &&			 /* frame in queue */
-			   qHead->first->ready )		 /* frame is ready for being sent */
+			   !MQ_EMPTY(qHead) )			 /* frame in queue */
 	{
 		IDBGWRT_3((DBH, "   >>> %s: processing new frame %4d; size=0x%04X\n",
 					functionName, qHead->first->frame[0], qHead->first->size));
-		/* set frame inactive so if interrupted by ISR, this frame is not sent twice */
-		qHead->first->ready = 0;
+		/* mark frame active so if interrupted by ISR, this frame is not sent twice */
 		qHead->first->xfering = 1;
 
 		llHdl->chan[ch].txBufEmpty = 0;
@@ -1745,15 +3078,15 @@ static int32 M75_TxData_Async(
 		MWRITE_D8( llHdl->ma, DATA_REG_A+(ch<<1), qHead->first->frame[0] );
 
 		/* enable Tx */
-		WRITE_SCC_REG( llHdl->ma, ch, M75_R05, (llHdl->chan[ch].sccRegs.wr05 | M75_SCC_WR05_TX_EN) );
+		IWRITE_SCC_REG( llHdl->ma, ch, 05, (llHdl->chan[ch].sccRegs.wr05 | M75_SCC_WR05_TX_EN) );
 	} else {
-		IDBGWRT_3((DBH, "     %s (not sent!): txBufEmpty=%d; totEntries=%d; ready=%d; qinit=%d\n",
-						functionName, llHdl->chan[ch].txBufEmpty, qHead->totEntries, qHead->first->ready, qHead->qinit));
+		IDBGWRT_3((DBH, "     %s (not sent!): txBufEmpty=%d; entries=%d; qinit=%d\n",
+						functionName, llHdl->chan[ch].txBufEmpty, MQ_CNT(qHead), qHead->qinit));
 
 		/* got for what reason ever, just acknowledge IRQ so CRC, ... is beeing sent */
 		/* reset Tx interrupt pending, reset highest IUS */
-		WRITE_SCC_REG( llHdl->ma, ch, M75_R00, M75_SCC_WR00_RST_TXINT );
-		WRITE_SCC_REG( llHdl->ma, ch, M75_R00, M75_SCC_WR00_RST_HIGH_IUS );
+		IWRITE_SCC_CMD2( llHdl->ma, ch, M75_SCC_WR00_RST_TXINT,
+						 M75_SCC_WR00_RST_HIGH_IUS );
 	}
 
 ERR_ABORT:
@@ -1762,6 +3095,173 @@ ERR_ABORT:
 	return(ERR_SUCCESS);
 } /* M75_TxData_Async */
 
+/****************************** M75_TxFifo_Async *****************************/
+/** Transfer data from the Tx queue to the Tx FIFO in async mode.
+ *
+ *  Each queue entry is written into the external Tx FIFO as a whole and
+ *  fed to the SCC by the FIFO logic (DTR/REQ), so no Tx interrupt per
+ *  character is needed. The entry is returned to the queue when the FIFO
+ *  has drained, checked by the alarm after the estimated transmission time
+ *  or by the next M_setblock (M75_ASY_TX_FIFO).
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch          \IN  current channel
+ *
+ *  \return            \c 0 on success or error code
+ */
+static int32 M75_TxFifo_Async(
+	LL_HANDLE *llHdl,
+	int32 ch
+)
+{
+	MQUEUE_HEAD *qHead = &llHdl->chan[ch].txQ;
+	MQUEUE_ENT *ent;
+	OSS_IRQ_STATE irqState;
+	u_int8 retVal;
+    DBGCMD( static const char functionName[] = "LL - M75_Tx (ASYNC FIFO)"; )
+
+	IDBGWRT_2((DBH, "   >>> %s: ch=%d; entries=%d\n", functionName, ch, MQ_CNT(qHead)));
+
+	irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+
+	if( llHdl->chan[ch].txFifoSt == M75_TXF_DRAIN ) {
+		retVal = MREAD_D8( llHdl->ma, FIFO_STATREG_A+(ch<<1) );
+		if( !(retVal & M75_FIFO_STATREG_TXFIFO_EMPTY) ) {
+			/* entry still being sent */
+			OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+			IDBGWRT_2((DBH, "   <<< %s: Tx FIFO not empty\n", functionName));
+			return(ERR_SUCCESS);
+		}
+
+		/* entry passed to the SCC completely, return it to the queue */
+		M75_STAT_TX( llHdl, ch, qHead->first->size );
+		MQ_GET(qHead);
+		llHdl->chan[ch].txFifoSt = M75_TXF_IDLE;
+		if( MQ_EMPTY(qHead) )
+			M75_TxDrainWake( llHdl, ch );
+
+		/* send semaphore if BlockWrite is waiting for free buffer space */
+		if( qHead->waiting ) {
+			IDBGWRT_3((DBH, "    %s: wake write waiter\n", functionName));
+			qHead->waiting = FALSE;
+			OSS_SemSignal( llHdl->osHdl, qHead->sem );
+		}
+	}
+
+	if( llHdl->chan[ch].txFifoSt != M75_TXF_IDLE ||	/* FIFO in use */
+		MQ_EMPTY(qHead) ||
+		!qHead->qinit ) {
+		OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+		IDBGWRT_3((DBH, "    %s (not sent): txFifoSt=%d; entries=%d; qinit=%d\n",
+						functionName, llHdl->chan[ch].txFifoSt, MQ_CNT(qHead), qHead->qinit));
+		return(ERR_SUCCESS);
+	}
+
+	/* claim Tx FIFO so if interrupted, this entry is not sent twice */
+	llHdl->chan[ch].txFifoSt = M75_TXF_LOAD;
+	OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+
+	/* entry was written by BlockWrite before putCnt */
+	M75_MB();
+	ent = qHead->first;
+
+	IDBGWRT_3((DBH, "    %s: entry size=0x%04X\n", functionName, ent->size));
+
+	/* enable Tx and Tx FIFO, the SCC takes the data while it is written */
+	WRITE_SCC_REG( llHdl->ma, ch, M75_R05, llHdl->chan[ch].sccRegs.wr05 | M75_SCC_WR05_TX_EN );
+	MWRITE_D8( llHdl->ma, FIFO_STATREG_A+(ch<<1), M75_FIFO_STATREG_TXEN );
+	MFIFO_WRITE_D8( llHdl->ma, (FIFO_REG_A+(ch<<1)), ent->size, ent->frame );
+
+	llHdl->chan[ch].txFifoSt = M75_TXF_DRAIN;
+	/* fails if the alarm of the previous entry is still set (called by
+	 * M75_BlockWrite), that one checks this entry every millisecond */
+	if( OSS_AlarmSet( llHdl->osHdl, llHdl->chan[ch].txAlarm,
+					  M75_TxFifoMsec( llHdl, ch, ent->size ), 0, NULL ) ) {
+		IDBGWRT_3((DBH, "    %s: txAlarm still set\n", functionName));
+	}
+
+	IDBGWRT_2((DBH, "   <<< %s\n", functionName));
+	return(ERR_SUCCESS);
+} /* M75_TxFifo_Async */
+
+/****************************** M75_TxFifoAlarm ******************************/
+/** Alarm routine, checks that the external Tx FIFO has drained (async mode)
+ *
+ *  Returns the sent entry to the Tx queue and loads the next one. While the
+ *  FIFO is not empty yet, the check is repeated every millisecond.
+ *
+ *  \param arg         \IN  channel object
+ */
+static void M75_TxFifoAlarm(
+	void *arg
+)
+{
+	CHN_OBJ *chan = (CHN_OBJ*)arg;
+	LL_HANDLE *llHdl = chan->llHdl;
+	OSS_IRQ_STATE irqState;
+	u_int8 retVal;
+
+	irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+	if( chan->txFifoSt == M75_TXF_DRAIN ) {
+		retVal = MREAD_D8( llHdl->ma, FIFO_STATREG_A+(chan->num<<1) );
+		if( !(retVal & M75_FIFO_STATREG_TXFIFO_EMPTY) ) {
+			/* estimate too short, e.g. Tx held by CTS */
+			OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+			if( OSS_AlarmSet( llHdl->osHdl, chan->txAlarm, 1, 0, NULL ) ) {
+				DBGWRT_ERR((DBH, "*** LL - M75_TxFifoAlarm: can't set txAlarm\n"));
+			}
+			return;
+		}
+	}
+	OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+
+	M75_TxFifo_Async( llHdl, chan->num );
+
+	irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+	M75_EvCheck( llHdl );
+	OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+} /* M75_TxFifoAlarm */
+
+/****************************** M75_TxFifoMsec *******************************/
+/** Estimate the time the SCC needs to send a number of characters (async)
+ *
+ *  Calculated from the BR generator time constant, clock mode, character
+ *  length, parity and stop bits in the register mirror. The BR generator
+ *  is expected to run from PCLK (WR14_DEFAULT).
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch          \IN  current channel
+ *  \param size        \IN  number of characters
+ *
+ *  \return            time (ms), at least 1
+ */
+static u_int32 M75_TxFifoMsec(
+	LL_HANDLE *llHdl,
+	int32 ch,
+	u_int32 size
+)
+{
+	static const u_int32 clkMult[4] = { 1, 16, 32, 64 };	/* WR04 D7..D6 */
+	static const u_int32 bpc[4]		= { 5, 7, 6, 8 };		/* WR05 D6..D5 */
+	SCC_REG *regs = &llHdl->chan[ch].sccRegs;
+	u_int32 tconst, halfBits, ticks, usec;
+
+	tconst = regs->wr12 | (regs->wr13 << 8);
+
+	/* start, data and parity bits, 1/1.5/2 stop bits, in half bits */
+	halfBits = 2 * (1 + bpc[(regs->wr05 & M75_SCC_WR05_TX_BPC_MASK) >> 5] +
+					(regs->wr04 & 0x01)) +
+			   ((regs->wr04 >> 2) & 0x03) + 1;
+
+	/* PCLK ticks per character, one bit lasts 2*(tconst+2) ticks * clkMult */
+	ticks = halfBits * (tconst + 2) * clkMult[regs->wr04 >> 6];
+
+	/* usec per character, ticks * 10^6 / M75_PCLK without overflow */
+	usec = (ticks >> 4) * 625 / (M75_PCLK / 25600);
+
+	return( size * (usec / 1000) + (size * (usec % 1000)) / 1000 + 1 );
+} /* M75_TxFifoMsec */
+
 
 /****************************** M75_IrqExtStat *******************************/
 /** Interrupt service routine for Ext/Status IRQs
@@ -1774,15 +3274,26 @@ static int32 M75_IrqExtStat(
    LL_HANDLE *llHdl,
    u_int32 chan
 ) {
-	u_int32 rr0=0;
+	u_int32 rr0=0, eom=0;
     DBGCMD( static const char functionName[] = "LL - M75_IrqExtStat"; )
 
-	READ_SCC_REG( llHdl->ma, chan, M75_R00, rr0 );
+	IREAD_SCC_REG( llHdl->ma, chan, M75_R00, rr0 );
 	IDBGWRT_2((DBH, "   >>> %s RR0 = 0x%02X\n", functionName, rr0));
 
 	/* reset Ext/Status int, reset highest IUS */
-	WRITE_SCC_REG( llHdl->ma, chan, M75_R00, M75_SCC_WR00_RST_EXT_STAT );
-	WRITE_SCC_REG( llHdl->ma, chan, M75_R00, M75_SCC_WR00_RST_HIGH_IUS );
+	IWRITE_SCC_CMD2( llHdl->ma, chan, M75_SCC_WR00_RST_EXT_STAT,
+					 M75_SCC_WR00_RST_HIGH_IUS );
+
+	/* RR00 was frozen while the IP was pending: an EOM claimed by
+	 * M75_TxClaim_Sync() meanwhile is still shown, the reset RR00 tells
+	 * whether the latch is set again */
+	if( (rr0 & M75_SCC_RR00_TX_UNDR_EOM) && llHdl->chan[chan].txEomClaimed ) {
+		llHdl->chan[chan].txEomClaimed = FALSE;
+		IREAD_SCC_REG( llHdl->ma, chan, M75_R00, eom );
+		rr0 = (rr0 & ~M75_SCC_RR00_TX_UNDR_EOM) |
+			  (eom & M75_SCC_RR00_TX_UNDR_EOM);
+		IDBGWRT_2((DBH, "   >>> %s: EOM claimed, RR0 = 0x%02X\n", functionName, rr0));
+	}
 
 	if( (rr0 & M75_SCC_RR00_BREAK_ABORT) ) {
 		/* Break/Abort */
@@ -1804,8 +3315,10 @@ static int32 M75_IrqExtStat(
 		MWRITE_D8( llHdl->ma, FIFO_STATREG_A+(chan<<1), 0x00 );
 
 		/* flag interrupt, send next frame if available */
+		M75_TxDone(llHdl,chan);
 		llHdl->chan[chan].txUnderrEOMgot = 1;
 		M75_Tx(llHdl,chan);
+		M75_TxDrainWake(llHdl,chan);
 
 	} else if( rr0 & M75_SCC_RR00_SYNC_HUNT ) {
 		IDBGWRT_2((DBH, "   >>> %s: Sync-Hunt IP ch %s\n", functionName, chan ? "B" : "A"));
@@ -1830,6 +3343,11 @@ static int32 M75_IrqExtStat(
  *
  *  The interrupt is triggered when data is received (special condition only)
  *  errors are received or data is fully transmitted (incl. CRC).
+ *  Every RR03 read is acknowledged once through RR02 and all IPs found are
+ *  serviced in the same pass, so ch B does not wait for a further pass.
+ *  The channel served first alternates with every pass.
+ *  When IPs are still pending after M75_STORM_LOOPS passes, their sources
+ *  are disabled for M75_STORM_MSEC, see M75_IrqStorm().
  *
  *  \param llHdl  	   \IN  low-level handle
  *  \return LL_IRQ_DEVICE	irq caused by device
@@ -1840,12 +3358,15 @@ static int32 M75_Irq(
    LL_HANDLE *llHdl
 )
 {
-	u_int32 iPend=0, rr2=0;
-	u_int32 ch=0;
+	u_int32 iPend=0, rr2=0, ip;
+	u_int32 ch=0, i, passes=0;
+#ifdef M75_IRQ_STATS
+	u_int32 tStart = M75_TSTAMP_GET(llHdl), loops = 0;
+#endif
     IDBGWRT_1((DBH, ">>> M75_Irq:\n"));
 
 	/* get Interrupt source */
-	READ_SCC_REG( llHdl->ma, 0, M75_R03, iPend );
+	IREAD_SCC_REG( llHdl->ma, 0, M75_R03, iPend );
 	IDBGWRT_2((DBH, ">>>     RR03 = 0x%02X (IP Reg)\n", iPend));
 
 	if( !iPend ) {
@@ -1854,96 +3375,422 @@ static int32 M75_Irq(
 	}
 
 	while( iPend ) {
-		/* get modified Interrupt Vector, Irq is resetted here */
-		READ_SCC_REG( llHdl->ma, 1, M75_R02, rr2 );
+		/* get modified Interrupt Vector, Irq is resetted here;
+		 * one acknowledge per RR03 read, the handlers reset the IUS */
+		IREAD_SCC_REG( llHdl->ma, 1, M75_R02, rr2 );
 		IDBGWRT_2((DBH, ">>>     RR02 = 0x%02X (IV Reg)\n", rr2));
+		(void)rr2;	/* read for the acknowledge only */
 		llHdl->irqCount++;
-
-#if 0
-		/* emergency break, to be removed later */
-		if( llHdl->irqCount >= 5000 ) {
-			IDBGWRT_ERR((DBH,
-				"\n\n\n>>>ERR   M75_Irq: already processed 5000 Interrupts\n\n\n"));
-			/* disable IRQs in HW */
-			WRITE_SCC_REG( llHdl->ma, ch, M75_R09, llHdl->chan[ch].sccRegs.wr09 & ~M75_SCC_WR09_MIE );
-			break;
-		}
+#ifdef M75_IRQ_STATS
+		loops++;
 #endif
 
-		if( iPend & M75_SCC_RR03_CHA_RX_IP ){
-			/* ch A Rx IP */
-			IDBGWRT_2((DBH, ">>>     Rx IP ch A\n"));
-
-			ch = 0;
-			M75_IrqRx(llHdl, ch);
-
-			/* send error reset */
-			WRITE_SCC_REG( llHdl->ma, ch, M75_R00, M75_SCC_WR00_RST_ERROR );
-		} else if( iPend & M75_SCC_RR03_CHA_TX_IP ) {
-			/* ch A Tx IP */
-			ch = 0;
-			if(  M75_SYNC_MODE == llHdl->chan[ch].syncMode ) {
-				/* not used in SYNC mode, should never happen */
-				IDBGWRT_2((DBH, ">>>     Tx IP ch A, currently not handled/used\n"));
-			} else {
-				/* handle in async mode */
-				IDBGWRT_2((DBH, ">>>     Tx IP ch A\n"));
-				/* flag interrupt, send next frame if available */
-				llHdl->chan[ch].txBufEmpty = 1;
-				M75_TxData_Async(llHdl, ch);
-			}
-			/* reset Tx interrupt pending, reset highest IUS */
-			WRITE_SCC_REG( llHdl->ma, ch, M75_R00, M75_SCC_WR00_RST_TXINT );
-			WRITE_SCC_REG( llHdl->ma, ch, M75_R00, M75_SCC_WR00_RST_HIGH_IUS );
-		} else if( iPend & M75_SCC_RR03_CHA_EXTSTAT_IP ) {
-			/* ch A: Ext/Status IP */
-			ch = 0;
-			IDBGWRT_2((DBH, ">>>     Ext/Status IP ch A\n"));
-
-			M75_IrqExtStat(llHdl, ch);
-
-
-		} else if( iPend & M75_SCC_RR03_CHB_RX_IP ) {
-			/* ch B Rx IP */
-			IDBGWRT_2((DBH, ">>>     Rx IP ch B\n"));
-
-			ch = 1;
-			M75_IrqRx(llHdl, ch);
-
-			/* send error reset */
-			WRITE_SCC_REG( llHdl->ma, ch, M75_R00, M75_SCC_WR00_RST_ERROR );
-		} else if( iPend & M75_SCC_RR03_CHB_TX_IP ) {
-			/* ch B Tx IP */
-			ch = 1;
-			if(  M75_SYNC_MODE == llHdl->chan[ch].syncMode ) {
-				/* not used in SYNC mode, should never happen */
-				IDBGWRT_2((DBH, ">>>     Tx IP ch B, currently not handled/used\n"));
-			} else {
-				/* handle in async mode */
-				IDBGWRT_2((DBH, ">>>     Tx IP ch B\n"));
-				/* flag interrupt, send next frame if available */
-				llHdl->chan[ch].txBufEmpty = 1;
-				M75_TxData_Async(llHdl, ch);
-			}
-			/* reset Tx interrupt pending, reset highest IUS */
-			WRITE_SCC_REG( llHdl->ma, ch, M75_R00, M75_SCC_WR00_RST_TXINT );
-			WRITE_SCC_REG( llHdl->ma, ch, M75_R00, M75_SCC_WR00_RST_HIGH_IUS );
-		}else if( iPend & M75_SCC_RR03_CHB_EXTSTAT_IP ) {
-			/* ch B Ext/Status IP */
-			ch = 1;
-			IDBGWRT_2((DBH, ">>>     Ext/Status IP ch B\n"));
-			M75_IrqExtStat(llHdl, ch);
+		/* service all IPs of this RR03 read; the first channel alternates,
+		 * so a channel busy up to its Rx budget can't delay the other */
+		for( i=0; i<CH_NUMBER; i++ ) {
+			ch = (llHdl->irqFirstCh + i) % CH_NUMBER;
+			if( (ip = M75_SCC_RR03_CH_IP(iPend, ch)) )
+				M75_IrqChan( llHdl, ch, ip );
 		}
+		llHdl->irqFirstCh = (llHdl->irqFirstCh + 1) % CH_NUMBER;
 
-		READ_SCC_REG( llHdl->ma, 0, M75_R03, iPend );
+		IREAD_SCC_REG( llHdl->ma, 0, M75_R03, iPend );
 		IDBGWRT_3((DBH, ">>>     RR03 = 0x%02X (IP Reg)\n", iPend));
+
+		/* interrupt storm: sources still pending after too many passes */
+		if( iPend && llHdl->stormLoops && ++passes >= llHdl->stormLoops ) {
+			IDBGWRT_ERR((DBH, ">>>ERR   M75_Irq: %d passes, RR03 = 0x%02X\n",
+						 passes, iPend));
+			for( ch=0; ch<CH_NUMBER; ch++ ) {
+				if( (ip = M75_SCC_RR03_CH_IP(iPend, ch)) )
+					M75_IrqStorm( llHdl, ch, ip );
+			}
+			break;
+		}
 		/* another interrupt available? */
 	}
 
+	M75_EvCheck( llHdl );
+
+#ifdef M75_IRQ_STATS
+	M75_IrqStats( llHdl, M75_TSTAMP_GET(llHdl) - tStart, loops );
+#endif
+
    		IDBGWRT_1((DBH, "<<< M75_Irq\n"));
 	return(LL_IRQ_DEVICE);		/* say: it's me */
 }
 
+/******************************** M75_IrqChan ********************************/
+/** Service the pending interrupts of one channel
+ *
+ *  Called by M75_Irq() for every channel with IPs in RR03. All sources
+ *  are handled in priority order Rx, Tx, Ext/Status, so a single RR03 read
+ *  serves every IP latched at that time.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch    	   \IN  channel
+ *  \param ip    	   \IN  IPs of channel (M75_SCC_RR03_xx_IP)
+ */
+static void M75_IrqChan(
+   LL_HANDLE *llHdl,
+   u_int32 ch,
+   u_int32 ip
+)
+{
+	if( ip & M75_SCC_RR03_RX_IP ){
+		IDBGWRT_2((DBH, ">>>     Rx IP ch %s\n", ch ? "B" : "A"));
+		llHdl->chan[ch].stats.irqRx++;
+		M75_IrqRx(llHdl, ch);
+
+		/* send error reset */
+		IWRITE_SCC_CMD( llHdl->ma, ch, M75_SCC_WR00_RST_ERROR );
+
+		/* SYNC mode: switch to polling above M75_RX_POLL_HI irqs/sec */
+		if( llHdl->chan[ch].rxPollHi &&
+			M75_SYNC_MODE == llHdl->chan[ch].syncMode ) {
+			u_int32 now = M75_TSTAMP_GET(llHdl);
+
+			if( now - llHdl->chan[ch].rxPollWin >= M75_TSTAMP_FREQ(llHdl) ) {
+				llHdl->chan[ch].rxPollWin = now;
+				llHdl->chan[ch].rxPollCnt = 0;
+			}
+			if( ++llHdl->chan[ch].rxPollCnt > llHdl->chan[ch].rxPollHi )
+				M75_RxPollMode( llHdl, ch, TRUE );
+		}
+	}
+
+	if( ip & M75_SCC_RR03_TX_IP ) {
+		llHdl->chan[ch].stats.irqTx++;
+		if(  M75_SYNC_MODE == llHdl->chan[ch].syncMode ) {
+			/* not used in SYNC mode, should never happen */
+			IDBGWRT_2((DBH, ">>>     Tx IP ch %s, currently not handled/used\n",
+					   ch ? "B" : "A"));
+		} else {
+			/* handle in async mode */
+			IDBGWRT_2((DBH, ">>>     Tx IP ch %s\n", ch ? "B" : "A"));
+			/* flag interrupt, send next frame if available */
+			llHdl->chan[ch].txBufEmpty = 1;
+			M75_TxData_Async(llHdl, ch);
+		}
+		/* reset Tx interrupt pending, reset highest IUS */
+		IWRITE_SCC_CMD2( llHdl->ma, ch, M75_SCC_WR00_RST_TXINT,
+						 M75_SCC_WR00_RST_HIGH_IUS );
+	}
+
+	if( ip & M75_SCC_RR03_EXTSTAT_IP ) {
+		llHdl->chan[ch].stats.irqExt++;
+		IDBGWRT_2((DBH, ">>>     Ext/Status IP ch %s\n", ch ? "B" : "A"));
+		M75_IrqExtStat(llHdl, ch);
+	}
+
+	/* interrupt storm: channel serviced above M75_STORM_RATE irqs/sec */
+	if( llHdl->stormRate ) {
+		u_int32 now = M75_TSTAMP_GET(llHdl);
+
+		if( now - llHdl->chan[ch].stormWin >= M75_TSTAMP_FREQ(llHdl) ) {
+			llHdl->chan[ch].stormWin = now;
+			llHdl->chan[ch].stormCnt = 0;
+		}
+		if( ++llHdl->chan[ch].stormCnt > llHdl->stormRate )
+			M75_IrqStorm( llHdl, ch, ip );
+	}
+} /* M75_IrqChan */
+
+/******************************** M75_RxPollMode *****************************/
+/** Switch Rx of a SYNC channel between interrupt and polling mode
+ *
+ *  In polling mode the Rx interrupt is disabled and M75_RxPollAlarm()
+ *  drains the status FIFO every M75_RX_POLL_MSEC. The pollAlarm sets
+ *  itself again while polling, so it is never cleared here; an alarm
+ *  still set when switching back finds rxPolling cleared. Must be called
+ *  with IRQs masked or from the ISR.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch    	   \IN  channel
+ *  \param poll        \IN  TRUE: polling mode, FALSE: interrupt mode
+ */
+static void M75_RxPollMode(
+   LL_HANDLE *llHdl,
+   u_int32 ch,
+   u_int8 poll
+)
+{
+	CHN_OBJ *chan = &llHdl->chan[ch];
+
+	IDBGWRT_2((DBH, ">>>     Rx ch %s: %s mode\n", ch ? "B" : "A",
+			   poll ? "polling" : "interrupt"));
+
+	/* account time of the mode left */
+	M75_RxModeTime( llHdl, ch );
+
+	if( poll ) {
+		IWRITE_SCC_REG( llHdl->ma, ch, 01,
+						chan->sccRegs.wr01 & ~M75_SCC_WR01_RX_SPEC_ONLY_IE );
+		chan->rxPolling = TRUE;
+		chan->stats.rxPollSwitch++;
+		if( !chan->rxPollArmed &&
+			!OSS_AlarmSet( llHdl->osHdl, chan->pollAlarm, chan->rxPollMsec,
+						   0, NULL ) )
+			chan->rxPollArmed = TRUE;
+	} else {
+		chan->rxPolling = FALSE;
+		/* during storm backoff M75_StormAlarm() enables Rx */
+		if( !(chan->stormMask & M75_SCC_WR01_RX_SPEC_ONLY_IE) )
+			IWRITE_SCC_REG( llHdl->ma, ch, 01,
+							chan->sccRegs.wr01 | M75_SCC_WR01_RX_SPEC_ONLY_IE );
+	}
+
+	/* new rate window */
+	chan->rxPollWin = M75_TSTAMP_GET(llHdl);
+	chan->rxPollCnt = 0;
+} /* M75_RxPollMode */
+
+/******************************** M75_RxPollAlarm ****************************/
+/** Alarm routine, polls the Rx status FIFO of a SYNC channel
+ *
+ *  Drains the status FIFO with M75_RxDrain_Sync() with IRQs masked, no
+ *  Rx interrupt is pending to acknowledge. Counts the frames received per
+ *  second and switches back to interrupt mode when less than
+ *  M75_RX_POLL_LO frames were received.
+ *
+ *  \param arg         \IN  channel object
+ */
+static void M75_RxPollAlarm(
+	void *arg
+)
+{
+	CHN_OBJ *chan = (CHN_OBJ*)arg;
+	LL_HANDLE *llHdl = chan->llHdl;
+	u_int32 ch = chan->num;
+	u_int32 rxFrames, now;
+	OSS_IRQ_STATE irqState;
+
+	irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+	chan->rxPollArmed = FALSE;
+	if( !chan->rxPolling ) {
+		OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+		return;
+	}
+
+	/* end of rate window: traffic dropped? */
+	now = M75_TSTAMP_GET(llHdl);
+	if( now - chan->rxPollWin >= M75_TSTAMP_FREQ(llHdl) ) {
+		if( chan->rxPollCnt < chan->rxPollLo )
+			M75_RxPollMode( llHdl, ch, FALSE );
+		chan->rxPollWin = now;
+		chan->rxPollCnt = 0;
+	}
+
+	/* drain the status FIFO, also after switching back:
+	 * frames completed while the Rx interrupt was disabled */
+	rxFrames = chan->stats.rxFrames;
+	M75_RxDrain_Sync( llHdl, ch, 0 );
+	IWRITE_SCC_CMD( llHdl->ma, ch, M75_SCC_WR00_RST_ERROR );
+	if( chan->rxPolling ) {
+		chan->rxPollCnt += chan->stats.rxFrames - rxFrames;
+		/* poll again, unless M75_RxPollMode() did already */
+		if( !chan->rxPollArmed &&
+			!OSS_AlarmSet( llHdl->osHdl, chan->pollAlarm, chan->rxPollMsec,
+						   0, NULL ) )
+			chan->rxPollArmed = TRUE;
+	}
+	M75_EvCheck( llHdl );
+
+	OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+} /* M75_RxPollAlarm */
+
+/******************************** M75_RxModeTime *****************************/
+/** Account the time spent in the current Rx mode in the statistics
+ *
+ *  Must be called with IRQs masked or from the ISR.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch    	   \IN  channel
+ */
+static void M75_RxModeTime(
+   LL_HANDLE *llHdl,
+   u_int32 ch
+)
+{
+	CHN_OBJ *chan = &llHdl->chan[ch];
+	u_int32 now = M75_TSTAMP_GET(llHdl);
+
+	if( chan->rxPolling )
+		chan->stats.rxPollTime += now - chan->rxModeStart;
+	else
+		chan->stats.rxIrqTime += now - chan->rxModeStart;
+	chan->rxModeStart = now;
+} /* M75_RxModeTime */
+
+/******************************** M75_MsecLeft *******************************/
+/** Time left of a period started at a timestamp
+ *
+ *  Used by alarms set once for a period that was extended meanwhile,
+ *  OSS_AlarmSet() fails on an alarm already set.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param start       \IN  start of period (timestamp)
+ *  \param msec        \IN  length of period (msec)
+ *  \return msec left, 0: period over
+ */
+static u_int32 M75_MsecLeft(
+   LL_HANDLE *llHdl,
+   u_int32 start,
+   u_int32 msec
+)
+{
+	u_int32 freq = M75_TSTAMP_FREQ(llHdl);
+	u_int32 ticks = M75_TSTAMP_GET(llHdl) - start;
+	u_int32 past;
+
+	if( freq >= 1000 )
+		past = ticks / (freq / 1000);
+	else
+		past = ticks * 1000 / freq;
+
+	return( past < msec ? msec - past : 0 );
+} /* M75_MsecLeft */
+
+/******************************** M75_IrqStorm *******************************/
+/** Disable interrupt sources of a channel for the storm backoff
+ *
+ *  Clears the WR01 interrupt enables of the sources in \a ip and sets
+ *  the stormAlarm, which enables them again after M75_STORM_MSEC.
+ *  Called from the ISR.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch    	   \IN  channel
+ *  \param ip    	   \IN  IPs of channel (M75_SCC_RR03_xx_IP)
+ */
+static void M75_IrqStorm(
+   LL_HANDLE *llHdl,
+   u_int32 ch,
+   u_int32 ip
+)
+{
+	CHN_OBJ *chan = &llHdl->chan[ch];
+	u_int8 bits = 0;
+
+	if( ip & M75_SCC_RR03_RX_IP )
+		bits |= M75_SCC_WR01_RX_SPEC_ONLY_IE;
+	if( ip & M75_SCC_RR03_TX_IP )
+		bits |= M75_SCC_WR01_TX_IE;
+	if( ip & M75_SCC_RR03_EXTSTAT_IP )
+		bits |= M75_SCC_WR01_EXT_IE;
+	bits &= chan->sccRegs.wr01;
+	if( !bits )
+		return;
+
+	IDBGWRT_ERR((DBH, ">>>ERR   M75_IrqStorm: ch %s, WR01 0x%02X disabled\n",
+				 ch ? "B" : "A", bits));
+	IWRITE_SCC_REG( llHdl->ma, ch, 01, chan->sccRegs.wr01 & ~bits );
+
+	/* further sources join the running backoff */
+	if( !chan->stormMask ) {
+		chan->stats.irqStorm++;
+		if( chan->stormSig )
+			OSS_SigSend( llHdl->osHdl, chan->stormSig );
+		/* fails if the alarm of a backoff ended by M75_IRQ_ENABLE is
+		 * still set, then that one ends this backoff */
+		if( OSS_AlarmSet( llHdl->osHdl, chan->stormAlarm, llHdl->stormMsec,
+						  0, NULL ) ) {
+			IDBGWRT_ERR((DBH, ">>>ERR   M75_IrqStorm: stormAlarm already set\n"));
+		}
+	}
+	chan->stormMask |= bits;
+} /* M75_IrqStorm */
+
+/******************************** M75_StormAlarm *****************************/
+/** Alarm routine, enables the sources disabled by M75_IrqStorm() again
+ *
+ *  The Rx interrupt stays off while the channel is in Rx polling mode or
+ *  the deferred Rx list is full, those enable it when done.
+ *  The SCC doesn't latch Tx IPs while the Tx interrupt is disabled, so
+ *  Tx buffer empty and Tx Underrun/EOM conditions are checked in RR00.
+ *  M75_TxData_Async() and M75_Tx() mask IRQs themselves and are called
+ *  unmasked.
+ *
+ *  \param arg         \IN  channel object
+ */
+static void M75_StormAlarm(
+	void *arg
+)
+{
+	CHN_OBJ *chan = (CHN_OBJ*)arg;
+	LL_HANDLE *llHdl = chan->llHdl;
+	u_int32 ch = chan->num;
+	u_int32 ip=0, rr0=0;
+	u_int8 bits, txData = FALSE, txFrame = FALSE;
+	OSS_IRQ_STATE irqState;
+
+	irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+	if( !chan->stormMask ) {
+		OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+		return;
+	}
+
+	bits = chan->stormMask;
+	if( chan->rxPolling || chan->rxPendFull )
+		bits &= ~M75_SCC_WR01_RX_SPEC_ONLY_IE;
+	chan->stormMask = 0;
+	IWRITE_SCC_REG( llHdl->ma, ch, 01, chan->sccRegs.wr01 | bits );
+	chan->stats.irqStormRearm++;
+
+	/* Tx conditions missed during the backoff */
+	IREAD_SCC_REG( llHdl->ma, 0, M75_R03, ip );
+	ip = M75_SCC_RR03_CH_IP( ip, ch );
+	IREAD_SCC_REG( llHdl->ma, ch, M75_R00, rr0 );
+	if( (bits & M75_SCC_WR01_TX_IE) && !(ip & M75_SCC_RR03_TX_IP) &&
+		(rr0 & M75_SCC_RR00_TX_BUF_EMPTY) ) {
+		chan->txBufEmpty = 1;
+		txData = TRUE;
+	}
+	/* send next frame if the EOM latch is set */
+	if( (bits & M75_SCC_WR01_EXT_IE) && !(ip & M75_SCC_RR03_EXTSTAT_IP) &&
+		M75_SYNC_MODE == chan->syncMode )
+		txFrame = TRUE;
+	OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+
+	if( txData )
+		M75_TxData_Async( llHdl, ch );
+	if( txFrame )
+		M75_Tx( llHdl, ch );
+
+	irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+	/* new rate window */
+	chan->stormWin = M75_TSTAMP_GET(llHdl);
+	chan->stormCnt = 0;
+
+	if( chan->stormSig )
+		OSS_SigSend( llHdl->osHdl, chan->stormSig );
+	M75_EvCheck( llHdl );
+
+	OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+} /* M75_StormAlarm */
+
+#ifdef M75_IRQ_STATS
+/******************************** M75_IrqStats *******************************/
+/** Account one ISR call in the ISR statistics
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param irqTime     \IN  ISR duration (timestamp ticks)
+ *  \param loops       \IN  number of RR03 loops
+ */
+static void M75_IrqStats(LL_HANDLE *llHdl, u_int32 irqTime, u_int32 loops)
+{
+	M75_IRQSTATS *is = &llHdl->irqStats;
+
+	is->irqNum++;
+	M75_HIST_LOG2( is->timeHist, irqTime, M75_IRQSTATS_HIST_NUM );
+	M75_HIST_LOG2( is->loopHist, loops, M75_IRQSTATS_HIST_NUM );
+
+	if( irqTime > is->maxIrqTime )
+		llHdl->maxIrqTime = is->maxIrqTime = irqTime;
+	if( loops > is->maxLoops )
+		is->maxLoops = loops;
+}
+#endif /* M75_IRQ_STATS */
+
 /* currently break/Abort commands are ignored, since no clean way to handle */
 #ifdef M75_SUPPORT_BREAK_ABORT
 /************************** M75_BreakAbortHandler **************************/
@@ -1954,6 +3801,7 @@ static int32 M75_Irq(
  *  \return ERR_SUCCESS
  */
 static int32 M75_BreakAbortHandler(LL_HANDLE *llHdl, u_int32 ch){
+	u_int8 wr15 = llHdl->chan[ch].sccRegs.wr15;
 
 	if( llHdl->chan[ch].sccRegs.wr03 & M75_SCC_WR03_RX_EN ) {
 		/* Abort Handling only interesting when Rx enabled */
@@ -1977,12 +3825,13 @@ static int32 M75_BreakAbortHandler(LL_HANDLE *llHdl, u_int32 ch){
 		/* reset external Rx FIFO and status FIFO */
 		MWRITE_D8( llHdl->ma, FIFO_RESET_REG, 0x04<<(ch*4) );
 
-		WRITE_SCC_REG( llHdl->ma, ch, M75_R15,
-					   llHdl->chan[ch].sccRegs.wr15 & (M75_SCC_WR15_WR7P_EN | M75_SCC_WR15_SDLC_FIFO_EN | M75_SCC_WR15_DCD_IE) );
-		WRITE_SCC_REG( llHdl->ma, ch, M75_R15,
-					   llHdl->chan[ch].sccRegs.wr15 | M75_SCC_WR15_SDLC_FIFO_EN );
+		IWRITE_SCC_REG( llHdl->ma, ch, 15,
+					   wr15 & (M75_SCC_WR15_WR7P_EN | M75_SCC_WR15_SDLC_FIFO_EN | M75_SCC_WR15_DCD_IE) );
+		IWRITE_SCC_REG( llHdl->ma, ch, 15,
+					   wr15 | M75_SCC_WR15_SDLC_FIFO_EN );
 
 		llHdl->chan[ch].rxERR = M75_ERR_RX_BREAKABORT;
+		llHdl->chan[ch].stats.breakAbort++;
 		/* Send signal to application if enabled */
 		if( llHdl->chan[ch].sig && !llHdl->chan[ch].rxQ.errSent ) {
 			IDBGWRT_3((DBH, ">>>    send Rx ch %d signal to application\n", ch));
@@ -2020,71 +3869,123 @@ static int32 M75_BreakAbortHandler(LL_HANDLE *llHdl, u_int32 ch){
 static int32 M75_IrqRx(LL_HANDLE *llHdl, u_int32 ch)
 {
 	int32 error = ERR_SUCCESS;
+#ifdef M75_IRQ_STATS
+	u_int32 rxFrames = llHdl->chan[ch].stats.rxFrames;
+#endif
 	IDBGWRT_1((DBH, "LL - M75_IrqRx: ch=%d\n", ch));
 
 	if( M75_SYNC_MODE == llHdl->chan[ch].syncMode ) {
-		error = M75_IrqRx_Frame_Sync( llHdl,ch);
+		error = M75_IrqRx_Frame_Sync( llHdl, ch, llHdl->chan[ch].rxBudget );
 	} else {
 		error = M75_IrqRx_Data_Async( llHdl,ch);
 	}
+
+#ifdef M75_IRQ_STATS
+	rxFrames = llHdl->chan[ch].stats.rxFrames - rxFrames;
+	M75_HIST_LOG2( llHdl->irqStats.rxFramesHist, rxFrames,
+				   M75_IRQSTATS_HIST_NUM );
+	if( rxFrames > llHdl->irqStats.maxRxFrames )
+		llHdl->irqStats.maxRxFrames = rxFrames;
+#endif
 	return(error);
 }
 
 /****************************** M75_IrqRx_Frame_Sync *************************/
 /** Handler for Special Receive Condition Interrupts in SYNC modes
+ *
+ *  Resets the highest IUS and reads the status FIFO entries with
+ *  M75_RxDrain_Sync(), up to budget. Entries left over keep the Rx IP set,
+ *  M75_Irq() comes back for them after serving the other channel.
  *
  *  \param llHdl  	   \IN  low-level handle
  *  \param ch    	   \IN  channel that caused the interrupt
- *  \return M75_ERR_RX_QFULL	   Rx queue full or not initialized \n
- *          M75_ERR_RX_OVERFLOW    Overrun of the Status FIFO detected \n
- *          M75_ERR_RX_ERROR       Framing/CRC/Parity/Overrun Error \n
- *          M75_ERR_FRAMETOOLARGE  Frame is larger than rxQ.maxFrameSize \n
- *          ERR_SUCCESS            Valid frame received, put into Rx queue \n
+ *  \param budget  	   \IN  max. entries to read, 0: all (M75_RX_BUDGET)
+ *  \return            see M75_RxDrain_Sync()
  *
  * to be called only in M75_Irq, otherwise IrqMaskR/IrqRestore have to be
  * put in several places
  */
-static int32 M75_IrqRx_Frame_Sync(LL_HANDLE *llHdl, u_int32 ch){
+static int32 M75_IrqRx_Frame_Sync(LL_HANDLE *llHdl, u_int32 ch, u_int32 budget){
 
-	MQUEUE_ENT *rxEnt;
-	u_int8 *frame;
-	u_int8 retVal, rr7, rr6, rr1 = 0, rr0=0;
-	u_int32 rxSize = 0, breakAbortIEset=0, i;
-	u_int8 statusFIFOempty=0;
+	u_int8 rr0=0;
     DBGCMD( static const char functionName[] = "LL - M75_IrqRx (SYNC)"; )
 
-	rxEnt = llHdl->chan[ch].rxQ.last;
-	frame = rxEnt->frame;
-
-	READ_SCC_REG( llHdl->ma, ch, M75_R00, rr0 );
+	IREAD_SCC_REG( llHdl->ma, ch, M75_R00, rr0 );
 	IDBGWRT_2((DBH, "   >>> %s:RR00 = 0x%02X\n", functionName, rr0));
+	(void)rr0;	/* for the debug output only */
 
 	/* clear interrupt, reset highest IUS */
-	WRITE_SCC_REG( llHdl->ma, ch, M75_R00, M75_SCC_WR00_RST_HIGH_IUS );
+	IWRITE_SCC_CMD( llHdl->ma, ch, M75_SCC_WR00_RST_HIGH_IUS );
+
+	return( M75_RxDrain_Sync( llHdl, ch, budget ) );
+} /* M75_IrqRx_Frame_Sync */
+
+/****************************** M75_RxDrain_Sync *****************************/
+/** Read the entries of the SYNC Rx status FIFO
+ *
+ *  Reads the entries of the status FIFO, up to budget. The frame data is
+ *  read by M75_RxFrame_Sync() here or, with M75_RX_DEFER, later by
+ *  M75_RxDeferAlarm(). Issues no IUS reset, so besides the ISR (through
+ *  M75_IrqRx_Frame_Sync()) M75_RxPollAlarm() calls it with IRQs masked.
+ *  Without M75_RX_DEFER the frame data is copied from the FIFO here, in
+ *  the poll alarm with IRQs masked as well.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch    	   \IN  channel
+ *  \param budget  	   \IN  max. entries to read, 0: all (M75_RX_BUDGET)
+ *  \return M75_ERR_RX_QFULL	   Rx queue full or not initialized \n
+ *          M75_ERR_RX_OVERFLOW    Overrun of the Status FIFO detected \n
+ *          M75_ERR_RX_ERROR       Framing/CRC/Parity/Overrun Error \n
+ *          M75_ERR_FRAMETOOLARGE  Frame is larger than rxQ.maxFrameSize \n
+ *          ERR_SUCCESS            Valid frame received, put into Rx queue \n
+ */
+static int32 M75_RxDrain_Sync(LL_HANDLE *llHdl, u_int32 ch, u_int32 budget){
+
+	MQUEUE_HEAD *rxQ = &llHdl->chan[ch].rxQ;
+	RX_PEND *pend;
+	u_int8 rr7, rr6, rr1 = 0, wake = FALSE;
+	u_int32 rxSize = 0, breakAbortIEset=0, tstamp, entries = 0;
+	u_int8 statusFIFOempty=0, defer;
+	int32 error = ERR_SUCCESS;
+    DBGCMD( static const char functionName[] = "LL - M75_RxDrain (SYNC)"; )
 
 	/* disable Break/Abort Int
 	 * to avoid an out of frame Break/Abort interrupt */
 	if( (breakAbortIEset = (llHdl->chan[ch].sccRegs.wr15 & M75_SCC_WR15_BREAK_ABORT_IE)) )
-		WRITE_SCC_REG( llHdl->ma, ch, M75_R15,
+		IWRITE_SCC_REG( llHdl->ma, ch, 15,
 					   llHdl->chan[ch].sccRegs.wr15 & ~(M75_SCC_WR15_BREAK_ABORT_IE) );
 
 
 	while( !statusFIFOempty ) { /* pick up all frames already received */
-		if( (llHdl->chan[ch].rxQ.totEntries ==
-			   llHdl->chan[ch].rxQ.maxFrameNum) ||
-			  !llHdl->chan[ch].rxQ.qinit ){
+		/* keep deferring while entries are pending (M75_RX_DEFER switched
+		 * off), their data is still in the FIFO ahead of this frame */
+		defer = llHdl->chan[ch].rxDefer ||
+			    llHdl->chan[ch].rxPendPut != llHdl->chan[ch].rxPendGet;
+		if( defer ) {
+			if( RX_PEND_FULL(&llHdl->chan[ch]) ) {
+				/* stop Rx interrupt until M75_RxDeferAlarm caught up,
+				 * frames wait in the status FIFO */
+				IDBGWRT_3((DBH, "   >>> %s: pending list full\n", functionName));
+				IWRITE_SCC_REG( llHdl->ma, ch, 01,
+								llHdl->chan[ch].sccRegs.wr01 & ~M75_SCC_WR01_RX_SPEC_ONLY_IE );
+				llHdl->chan[ch].rxPendFull = TRUE;
+				break;
+			}
+		} else if( MQ_FULL(rxQ) || !rxQ->qinit ){
 			IDBGWRT_ERR((DBH, "   >>> ERR %s: Rx Error: M75_ERR_RX_QFULL\n", functionName));
+			llHdl->chan[ch].stats.rxQFull++;
 
 			/* count Status FIFO entries */
 			llHdl->chan[ch].rxStatCnt++;
 
 			if( llHdl->chan[ch].rxStatCnt > 10 ) {
 				/* Rx Status FIFO overflowed */
+				llHdl->chan[ch].stats.rxStatOvfl++;
 
 				llHdl->chan[ch].rxERR = M75_ERR_RX_OVERFLOW;
 
 				/* disable receiver */
-				WRITE_SCC_REG( llHdl->ma, ch, M75_R03,
+				IWRITE_SCC_REG( llHdl->ma, ch, 03,
 								llHdl->chan[ch].sccRegs.wr03 & ~(M75_SCC_WR03_RX_EN) );
 				IDBGWRT_ERR((DBH, "   >>> ERR %s: Rx Error: Status FIFO overflow,"
 									"receiver disabled\n", functionName));
@@ -2108,7 +4009,7 @@ static int32 M75_IrqRx_Frame_Sync(LL_HANDLE *llHdl, u_int32 ch){
 
 			/* enable Break/Abort interrupts again */
 			if( breakAbortIEset ){
-				WRITE_SCC_REG( llHdl->ma, ch, M75_R15,
+				IWRITE_SCC_REG( llHdl->ma, ch, 15,
 							   llHdl->chan[ch].sccRegs.wr15 | M75_SCC_WR15_BREAK_ABORT_IE);
 			}
 
@@ -2116,136 +4017,439 @@ static int32 M75_IrqRx_Frame_Sync(LL_HANDLE *llHdl, u_int32 ch){
 		}
 
 		/* get Rx status */
-		READ_SCC_REG( llHdl->ma, ch, M75_R07, rr7 );
-		READ_SCC_REG( llHdl->ma, ch, M75_R06, rr6 );
-
-		/* get source (special condition) */
-		READ_SCC_REG( llHdl->ma, ch, M75_R01, rr1 );
-		IDBGWRT_3((DBH, "   >>> %s: RR01 = 0x%02X\n", functionName, rr1));
+		IREAD_SCC_REG( llHdl->ma, ch, M75_R07, rr7 );
 
 		if( llHdl->chan[ch].rxStatCnt )
 			llHdl->chan[ch].rxStatCnt--;
 
 		if( !(rr7 & M75_SCC_RR07_FDA) ) {
-			/* Data from Status FIFO */
+			/* Status FIFO empty; don't read RR01, it would pop an entry
+			 * of a frame ending right now (polling mode) */
 			statusFIFOempty++;
-		} else if((rr1 & 0x70) || (rr7 & M75_SCC_RR07_FOS)) {
-			/* Rx CRC/Framing, Parity, Overrun Error */
-			IDBGWRT_ERR((DBH, "   >>> ERR %s: Rx Error: RR1 = 0x%02X, RR7 = 0x%02X\n", functionName, rr1, rr7));
+			continue;
+		}
+		IREAD_SCC_REG( llHdl->ma, ch, M75_R06, rr6 );
+
+		/* get source (special condition) */
+		IREAD_SCC_REG( llHdl->ma, ch, M75_R01, rr1 );
+		IDBGWRT_3((DBH, "   >>> %s: RR01 = 0x%02X\n", functionName, rr1));
+
+		rxSize = ((rr7 & M75_SCC_RR07_BC_MASK) << 8) + rr6;
+		tstamp = M75_TSTAMP_GET(llHdl);
+
+		if( defer ) {
+			/* pass status entry, M75_RxDeferAlarm reads the frame data */
+			pend = &llHdl->chan[ch].rxPend[llHdl->chan[ch].rxPendPut % M75_RX_PEND_NUM];
+			pend->rr1	 = rr1;
+			pend->rr7	 = rr7;
+			pend->size	 = rxSize;
+			pend->tstamp = tstamp;
+			M75_MB();
+			llHdl->chan[ch].rxPendPut++;
+		} else if( (error = M75_RxFrame_Sync( llHdl, ch, rr1, rr7, rxSize,
+											  tstamp, FALSE, &wake )) ) {
+			break;
+		}
+
+		/* work budget used up, M75_Irq comes back for the rest */
+		if( budget && ++entries >= budget ) {
+			llHdl->chan[ch].stats.rxBudgetOut++;
+			break;
+		}
+	}
+
+	/* start deferred frame copy */
+	M75_RxPendArm( llHdl, ch );
+
+	/* send semaphore if BlockRead is waiting for receive data */
+	if( wake && llHdl->chan[ch].rxQ.waiting ) {
+		IDBGWRT_3((DBH, "    wake read waiter\n"));
+		llHdl->chan[ch].rxQ.waiting = FALSE;
+		OSS_SemSignal( llHdl->osHdl, llHdl->chan[ch].rxQ.sem );
+	}
+
+	/* enable Break/Abort interrupts again */
+	if( breakAbortIEset ){
+		IWRITE_SCC_REG( llHdl->ma, ch, 15,
+					   llHdl->chan[ch].sccRegs.wr15 | M75_SCC_WR15_BREAK_ABORT_IE);
+	}
+
+	IDBGWRT_2((DBH, "   <<< %s\n", functionName));
+	return(error);
+} /* M75_RxDrain_Sync */
+
+/****************************** M75_RxFrame_Sync *****************************/
+/** Read the frame of one status FIFO entry in SYNC modes
+ *
+ *  Puts the frame into the Rx queue or discards its data on errors and
+ *  sends the Rx signal. The caller wakes the read waiter.
+ *  Must be called with IRQs masked or from the ISR.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch    	   \IN  channel
+ *  \param rr1    	   \IN  RR01 of status entry
+ *  \param rr7    	   \IN  RR07 of status entry
+ *  \param rxSize  	   \IN  frame size (bytes)
+ *  \param tstamp  	   \IN  arrival time of frame
+ *  \param dataRead	   \IN  TRUE: frame data already read from the FIFO
+ *                          into rxQ.last by M75_RxFrameRead()
+ *  \param wakeP  	   \OUT set to TRUE if read waiter must be woken
+ *  \return M75_ERR_RX_ERROR       Framing/CRC/Parity/Overrun Error \n
+ *          M75_ERR_FRAMETOOLARGE  Frame is larger than rxQ.maxFrameSize \n
+ *          ERR_SUCCESS            Valid frame received, put into Rx queue \n
+ */
+static int32 M75_RxFrame_Sync(
+	LL_HANDLE *llHdl,
+	u_int32 ch,
+	u_int8 rr1,
+	u_int8 rr7,
+	u_int32 rxSize,
+	u_int32 tstamp,
+	u_int8 dataRead,
+	u_int8 *wakeP
+)
+{
+	MQUEUE_HEAD *rxQ = &llHdl->chan[ch].rxQ;
+	MQUEUE_ENT *rxEnt;
+	u_int8 *frame;
+	u_int32 i;
+    DBGCMD( static const char functionName[] = "LL - M75_RxFrame_Sync"; )
+
+	if((rr1 & 0x70) || (rr7 & M75_SCC_RR07_FOS)) {
+		/* Rx CRC/Framing, Parity, Overrun Error */
+		IDBGWRT_ERR((DBH, "   >>> ERR %s: Rx Error: RR1 = 0x%02X, RR7 = 0x%02X\n", functionName, rr1, rr7));
+		if( rr1 & (M75_SCC_RR01_ERR_CRC_FRM | M75_SCC_RR01_ERR_PAR) )
+			llHdl->chan[ch].stats.rxCrcErr++;
+		if( rr1 & M75_SCC_RR01_ERR_RX_OVR )
+			llHdl->chan[ch].stats.rxOverrun++;
+		if( rr7 & M75_SCC_RR07_FOS )
+			llHdl->chan[ch].stats.rxStatOvfl++;
+		if( !llHdl->chan[ch].rxERR )
+			llHdl->chan[ch].rxERR = M75_ERR_RX_ERROR;
+
+		/* read to dummy to keep FIFO aligned */
+		for(i=0; !dataRead && i < rxSize; i++)
+			(void)MREAD_D8( llHdl->ma, FIFO_REG_A+(ch<<1) );
+
+		*wakeP = TRUE;
+		/* Send Signal to application if enabled */
+		if( llHdl->chan[ch].sig && !llHdl->chan[ch].rxQ.errSent ) {
+			IDBGWRT_3((DBH, "   >>> %s: send Rx ch A signal to application\n", functionName));
+			OSS_SigSend( llHdl->osHdl, llHdl->chan[ch].sig );
+			llHdl->chan[ch].rxQ.errSent++;
+		}
+
+		IDBGWRT_2((DBH, "   <<< %s: Rx CRC/Framing/Overrun ERROR\n", functionName));
+		return(M75_ERR_RX_ERROR);
+
+	} else if( (rr1 & M75_SCC_RR01_END_FRAME) ) {
+		/* detected EOF, get frame */
+		IDBGWRT_3((DBH, "   >>> %s: end of frame detected: ", functionName));
+
+		if( rxSize > llHdl->chan[ch].rxQ.maxFrameSize ) {
+			IDBGWRT_3((DBH, "Error\n"));
+			IDBGWRT_ERR((DBH, "   >>> ERR %s:  Rx Error: M75_ERR_FRAMETOOLARGE\n", functionName));
+
 			if( !llHdl->chan[ch].rxERR )
-				llHdl->chan[ch].rxERR = M75_ERR_RX_ERROR;
+				llHdl->chan[ch].rxERR = M75_ERR_FRAMETOOLARGE;
+			llHdl->chan[ch].stats.rxTooLarge++;
 
 			/* read to dummy to keep FIFO aligned */
-			rxSize = ((rr7 & M75_SCC_RR07_BC_MASK) << 8) + rr6;
-			for(i=0; i < rxSize; i++)
-				retVal = MREAD_D8( llHdl->ma, FIFO_REG_A+(ch<<1) );
+			for(i=0; !dataRead && i < rxSize; i++)
+				(void)MREAD_D8( llHdl->ma, FIFO_REG_A+(ch<<1) );
 
-			/* send semaphore if BlockRead is waiting for receive data */
-			if( llHdl->chan[ch].rxQ.waiting ) {
-				IDBGWRT_3((DBH, "   >>> %s: wake read waiter\n", functionName));
-				llHdl->chan[ch].rxQ.waiting = FALSE;
-				OSS_SemSignal( llHdl->osHdl, llHdl->chan[ch].rxQ.sem );
-			}
 			/* Send Signal to application if enabled */
-			if( llHdl->chan[ch].sig && !llHdl->chan[ch].rxQ.errSent ) {
+			if( llHdl->chan[ch].sig ) {
 				IDBGWRT_3((DBH, "   >>> %s: send Rx ch A signal to application\n", functionName));
 				OSS_SigSend( llHdl->osHdl, llHdl->chan[ch].sig );
-				llHdl->chan[ch].rxQ.errSent++;
 			}
 
-			/* enable Break/Abort interrupts again */
-			if( breakAbortIEset ){
-				WRITE_SCC_REG( llHdl->ma, ch, M75_R15,
-							   llHdl->chan[ch].sccRegs.wr15 | M75_SCC_WR15_BREAK_ABORT_IE);
-			}
+			*wakeP = TRUE;
+			IDBGWRT_2((DBH, "   <<< %s: ERROR: FRAME too large\n", functionName));
+			return( M75_ERR_FRAMETOOLARGE );
+		}
 
-			IDBGWRT_2((DBH, "   <<< %s: Rx CRC/Framing/Overrun ERROR\n", functionName));
-			return(M75_ERR_RX_ERROR);
+		M75_STAT_RX( llHdl, ch, rxSize );
 
-		} else if( (rr1 & M75_SCC_RR01_END_FRAME) ) {
-			/* detected EOF, get frame */
+		if( rxQ->directBuf && llHdl->chan[ch].rxDirect && !dataRead &&
+			MQ_EMPTY(rxQ) && (rxSize <= rxQ->directSize) ) {
+			/* reader waits on empty queue:
+			 * put frame into its buffer, bypass the queue */
+			MFIFO_READ_D8( llHdl->ma, (FIFO_REG_A+(ch<<1)), rxSize,
+						   rxQ->directBuf );
 
-			IDBGWRT_3((DBH, "   >>> %s: end of frame detected: ", functionName));
-			rxSize = ((rr7 & M75_SCC_RR07_BC_MASK) << 8) + rr6;
+			IDBGWRT_3((DBH, " received 0x%04X bytes (direct)\n", rxSize));
 
-			if( rxSize > llHdl->chan[ch].rxQ.maxFrameSize ) {
-				IDBGWRT_3((DBH, "Error\n"));
-				IDBGWRT_ERR((DBH, "   >>> ERR %s:  Rx Error: M75_ERR_FRAMETOOLARGE\n", functionName));
+			rxQ->directGot    = rxSize;
+			rxQ->directTstamp = tstamp;
+			rxQ->directDone   = TRUE;
+			rxQ->directBuf  = NULL;
+		} else {
+			rxEnt = rxQ->last;
+			frame = rxEnt->frame;
 
-				if( !llHdl->chan[ch].rxERR )
-					llHdl->chan[ch].rxERR = M75_ERR_FRAMETOOLARGE;
+			/* put frame into buffer */
+			if( !dataRead )
+				MFIFO_READ_D8(  llHdl->ma, (FIFO_REG_A+(ch<<1)),
+								((rxSize > rxQ->maxFrameSize) ?
+								 rxQ->maxFrameSize : rxSize),
+								frame );
 
-				/* read to dummy to keep FIFO aligned */
-				for(i=0; i < rxSize; i++)
-					retVal = MREAD_D8( llHdl->ma, FIFO_REG_A+(ch<<1) );
+			IDBGWRT_3((DBH, " received 0x%04X bytes\n", rxSize));
 
-				/* Send Signal to application if enabled */
-				if( llHdl->chan[ch].sig ) {
-					IDBGWRT_3((DBH, "   >>> %s: send Rx ch A signal to application\n", functionName));
-					OSS_SigSend( llHdl->osHdl, llHdl->chan[ch].sig );
-				}
+			/* update buffer, pass entry to reader */
+			rxEnt->size   = rxSize;
+			rxEnt->tstamp = tstamp;
+			MQ_PUT(rxQ);
 
-				/* send semaphore if BlockRead is waiting for receive data */
-				if( llHdl->chan[ch].rxQ.waiting ) {
-					IDBGWRT_3((DBH, "   >>> %s: wake read waiter\n", functionName));
-					llHdl->chan[ch].rxQ.waiting = FALSE;
-					OSS_SemSignal( llHdl->osHdl, llHdl->chan[ch].rxQ.sem );
-				}
+			IDBGDMP_4((DBH, "Rx Data:", frame, rxEnt->size, 1));
+		}
 
-				/* enable Break/Abort interrupts again */
-				if( breakAbortIEset ){
-					WRITE_SCC_REG( llHdl->ma, ch, M75_R15,
-								   llHdl->chan[ch].sccRegs.wr15 | M75_SCC_WR15_BREAK_ABORT_IE);
-				}
+		*wakeP = TRUE;
+		/* Send Signal to application if enabled */
+		if( llHdl->chan[ch].sig )
+			M75_RxSig( llHdl, ch );
+	}
 
-				IDBGWRT_2((DBH, "   <<< %s: ERROR: FRAME too large\n", functionName));
-				return( M75_ERR_FRAMETOOLARGE );
-			}
+	return(ERR_SUCCESS);
+} /* M75_RxFrame_Sync */
 
-			/* put frame into buffer */
-			MFIFO_READ_D8(  llHdl->ma, (FIFO_REG_A+(ch<<1)),
-							((rxSize > llHdl->chan[ch].rxQ.maxFrameSize) ?
-							 llHdl->chan[ch].rxQ.maxFrameSize : rxSize),
-							frame );
+/****************************** M75_RxSig ************************************/
+/** Send the Rx signal for a received frame, coalesced (SYNC mode)
+ *
+ *  Sends the signal when M75_RX_SIG_FRAMES frames are unsignalled,
+ *  otherwise sets the sigAlarm with the first one (M75_RX_SIG_USEC).
+ *  The sigAlarm is not cleared after sending, it measures the delay
+ *  from the first unsignalled frame when it fires.
+ *  Must be called with IRQs masked or from the ISR.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch    	   \IN  channel
+ */
+static void M75_RxSig(
+	LL_HANDLE *llHdl,
+	u_int32 ch
+)
+{
+	CHN_OBJ *chan = &llHdl->chan[ch];
+    DBGCMD( static const char functionName[] = "LL - M75_RxSig"; )
+
+	if( ++chan->rxSigCnt == 1 )
+		chan->rxSigFirst = M75_TSTAMP_GET(llHdl);
+
+	if( chan->rxSigCnt >= chan->rxSigFrames ) {
+		IDBGWRT_3((DBH, "   >>> %s: send Rx ch %s signal to application (%d frames)\n",
+				   functionName, (ch==0)?"A":"B", chan->rxSigCnt));
+		chan->rxSigCnt = 0;
+		chan->stats.rxSig++;
+		OSS_SigSend( llHdl->osHdl, chan->sig );
+	} else if( chan->rxSigUsec && !chan->rxSigArmed ) {
+		if( OSS_AlarmSet( llHdl->osHdl, chan->sigAlarm,
+						  (chan->rxSigUsec + 999) / 1000, 0, NULL ) ) {
+			IDBGWRT_ERR((DBH, "   >>> ERR %s: can't set sigAlarm\n", functionName));
+		} else {
+			chan->rxSigArmed = TRUE;
+		}
+	}
+} /* M75_RxSig */
 
+/****************************** M75_RxSigAlarm *******************************/
+/** Alarm routine, M75_RX_SIG_USEC expired for unsignalled frames
+ *
+ *  Set again for the rest of the delay if the frames counted arrived
+ *  after the alarm was set.
+ *
+ *  \param arg         \IN  channel object
+ */
+static void M75_RxSigAlarm(
+	void *arg
+)
+{
+	CHN_OBJ *chan = (CHN_OBJ*)arg;
+	LL_HANDLE *llHdl = chan->llHdl;
+	u_int32 left;
+	OSS_IRQ_STATE irqState;
 
-			IDBGWRT_3((DBH, " received 0x%04X bytes\n", rxSize));
+	irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+	chan->rxSigArmed = FALSE;
+	if( chan->rxSigCnt && chan->sig ) {
+		left = M75_MsecLeft( llHdl, chan->rxSigFirst,
+							 (chan->rxSigUsec + 999) / 1000 );
+		if( left ) {
+			if( !OSS_AlarmSet( llHdl->osHdl, chan->sigAlarm, left, 0, NULL ) )
+				chan->rxSigArmed = TRUE;
+		} else {
+			chan->rxSigCnt = 0;
+			chan->stats.rxSig++;
+			OSS_SigSend( llHdl->osHdl, chan->sig );
+		}
+	}
+	OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+} /* M75_RxSigAlarm */
 
-			/* update buffer */
-			rxEnt->size = rxSize;
-			rxEnt->ready++;
-			llHdl->chan[ch].rxQ.totEntries++;
-			llHdl->chan[ch].rxQ.last = llHdl->chan[ch].rxQ.last->next;
+/****************************** M75_RxFrameRead ******************************/
+/** Read the frame data of a pending status entry from the FIFO
+ *
+ *  Called by M75_RxDeferAlarm() with IRQs enabled. Reads the frame into
+ *  \a frame if M75_RxFrame_Sync() will put it into the Rx queue, otherwise
+ *  reads it to dummy to keep the FIFO aligned.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch    	   \IN  channel
+ *  \param pend    	   \IN  pending status entry
+ *  \param frame  	   \IN  frame buffer of rxQ.last, NULL: Rx queue full
+ */
+static void M75_RxFrameRead(
+	LL_HANDLE *llHdl,
+	u_int32 ch,
+	RX_PEND *pend,
+	u_int8 *frame
+)
+{
+	u_int32 i;
 
-			IDBGDMP_4((DBH, "Rx Data:", frame, rxEnt->size, 1));
+	if( !(pend->rr1 & 0x70) && !(pend->rr7 & M75_SCC_RR07_FOS) ) {
+		/* no data without end of frame */
+		if( !(pend->rr1 & M75_SCC_RR01_END_FRAME) )
+			return;
 
-			/* send semaphore if BlockRead is waiting for receive data */
-			if( llHdl->chan[ch].rxQ.waiting ) {
-				IDBGWRT_3((DBH, "    wake read waiter\n"));
-				llHdl->chan[ch].rxQ.waiting = FALSE;
-				OSS_SemSignal( llHdl->osHdl, llHdl->chan[ch].rxQ.sem );
-			}
+		if( frame && pend->size <= llHdl->chan[ch].rxQ.maxFrameSize ) {
+			MFIFO_READ_D8( llHdl->ma, (FIFO_REG_A+(ch<<1)), pend->size,
+						   frame );
+			return;
+		}
+	}
 
-			/* Send Signal to application if enabled */
-			if( llHdl->chan[ch].sig ) {
-				IDBGWRT_3((DBH, "   >>> %s: send Rx ch %s signal to application\n", functionName, (ch==0)?"A":"B"));
-				OSS_SigSend( llHdl->osHdl, llHdl->chan[ch].sig );
-			}
+	/* read to dummy to keep FIFO aligned */
+	for(i=0; i < pend->size; i++)
+		(void)MREAD_D8( llHdl->ma, FIFO_REG_A+(ch<<1) );
+} /* M75_RxFrameRead */
+
+/****************************** M75_RxDeferAlarm *****************************/
+/** Alarm routine, reads the frames of pending status entries (M75_RX_DEFER)
+ *
+ *  Runs outside the ISR, so the frame copy does not add to the time the
+ *  interrupt is blocked. Only the copy runs with IRQs enabled, the queue,
+ *  statistics and signals are updated masked. Frames arriving with the
+ *  Rx queue full are dropped, the status FIFO cannot hold them any longer.
+ *
+ *  \param arg         \IN  channel object
+ */
+static void M75_RxDeferAlarm(
+	void *arg
+)
+{
+	CHN_OBJ *chan = (CHN_OBJ*)arg;
+	LL_HANDLE *llHdl = chan->llHdl;
+	u_int32 ch = chan->num, get;
+	MQUEUE_HEAD *rxQ = &chan->rxQ;
+	RX_PEND *pend;
+	OSS_IRQ_STATE irqState;
+	u_int8 *frame, wake = FALSE;
+
+	irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+	/* entries put from now on need a new run */
+	chan->rxPendArmed = FALSE;
+
+	while( chan->rxPendGet != chan->rxPendPut ) {
+		get  = chan->rxPendGet;
+		pend = &chan->rxPend[get % M75_RX_PEND_NUM];
+
+		/* only this routine puts into the Rx queue while entries pend */
+		frame = (MQ_FULL(rxQ) || !rxQ->qinit) ? NULL : rxQ->last->frame;
+		OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
 
+		M75_RxFrameRead( llHdl, ch, pend, frame );
+
+		irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+		if( chan->rxPendGet != get )
+			continue;			/* discarded by M75_FIFO_RESET */
+
+		if( !frame ) {
+			DBGWRT_ERR((DBH, "*** LL - M75_RxDeferAlarm: Rx Error: M75_ERR_RX_QFULL\n"));
+			chan->stats.rxQFull++;
+			if( !chan->rxERR )
+				chan->rxERR = M75_ERR_RX_QFULL;
+
+			wake = TRUE;
+			if( chan->sig && !rxQ->errSent ) {
+				OSS_SigSend( llHdl->osHdl, chan->sig );
+				rxQ->errSent++;
+			}
+		} else {
+			M75_RxFrame_Sync( llHdl, ch, pend->rr1, pend->rr7, pend->size,
+							  pend->tstamp, TRUE, &wake );
 		}
+		chan->rxPendGet++;
 	}
-	/* enable Break/Abort interrupts again */
-	if( breakAbortIEset ){
-		WRITE_SCC_REG( llHdl->ma, ch, M75_R15,
-					   llHdl->chan[ch].sccRegs.wr15 | M75_SCC_WR15_BREAK_ABORT_IE);
+
+	/* pending list drained, Rx interrupt back on */
+	M75_RxPendResume( llHdl, ch );
+
+	/* send semaphore if BlockRead is waiting for receive data */
+	if( wake && rxQ->waiting ) {
+		rxQ->waiting = FALSE;
+		OSS_SemSignal( llHdl->osHdl, rxQ->sem );
 	}
+	M75_EvCheck( llHdl );
+	OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+} /* M75_RxDeferAlarm */
 
-	IDBGWRT_2((DBH, "   <<< %s\n", functionName));
-	return(ERR_SUCCESS);
-} /* M75_IrqRx_Frame_Sync */
+/****************************** M75_RxPendArm *******************************/
+/** Set the deferAlarm if status entries are pending and it is not set yet
+ *
+ *  rxPendArmed is only set when OSS_AlarmSet() succeeded, otherwise the
+ *  next call tries again. Called in the ISR or with IRQs masked.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch          \IN  current channel
+ */
+static void M75_RxPendArm(
+	LL_HANDLE *llHdl,
+	u_int32 ch
+)
+{
+	CHN_OBJ *chan = &llHdl->chan[ch];
+
+	if( chan->rxPendPut != chan->rxPendGet && !chan->rxPendArmed &&
+		!OSS_AlarmSet( llHdl->osHdl, chan->deferAlarm, 1, 0, NULL ) )
+		chan->rxPendArmed = TRUE;
+} /* M75_RxPendArm */
+
+/***************************** M75_RxPendResume *****************************/
+/** Switch the Rx interrupt back on after the pending list ran full
+ *
+ *  Called with IRQs masked once the pending list is empty. Polling mode
+ *  and storm backoff keep the Rx interrupt off.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch          \IN  current channel
+ */
+static void M75_RxPendResume(
+	LL_HANDLE *llHdl,
+	u_int32 ch
+)
+{
+	CHN_OBJ *chan = &llHdl->chan[ch];
+
+	if( !chan->rxPendFull )
+		return;
+
+	chan->rxPendFull = FALSE;
+	if( !chan->rxPolling &&
+		!(chan->stormMask & M75_SCC_WR01_RX_SPEC_ONLY_IE) )
+		IWRITE_SCC_REG( llHdl->ma, ch, 01,
+						chan->sccRegs.wr01 | M75_SCC_WR01_RX_SPEC_ONLY_IE );
+} /* M75_RxPendResume */
 
 /************************* M75_IrqRx_Data_Async ******************************/
 /** Handler for Special Receive Condition Interrupts in ASYNC modes
+ *
+ *  All characters available in the SCC Rx FIFO are read. RR01 is checked
+ *  before every character, or with M75_ASY_RX_BURST once when the FIFO is
+ *  drained, relying on the SCC latching Rx overrun and parity errors. In
+ *  burst mode framing errors are not latched and only seen if pending for
+ *  the last character of the burst.
  *
  *  \param llHdl  	   \IN  low-level handle
  *  \param ch    	   \IN  channel that caused the interrupt
@@ -2264,48 +4468,50 @@ static int32 M75_IrqRx_Data_Async(LL_HANDLE *llHdl, u_int32 ch){
 	u_int8 retVal, rr1 = 0, rr0=0;
 	u_int32 breakAbortIEset=0;
 	u_int8 rxEmpty;
+	u_int8 burst = llHdl->chan[ch].asyRxBurst;
+	u_int8 wake;
     DBGCMD( static const char functionName[] = "LL - M75_IrqRx (ASYNC)"; )
 
-	READ_SCC_REG( llHdl->ma, ch, M75_R00, rr0 );
+	IREAD_SCC_REG( llHdl->ma, ch, M75_R00, rr0 );
 	rxEmpty = !(rr0 & M75_SCC_RR00_RX_CHAR_AVAIL );
 
 	IDBGWRT_2((DBH, "   >>> %s: RR00 = 0x%02X\n", functionName, rr0));
 
 	/* clear interrupt, reset highest IUS */
-	WRITE_SCC_REG( llHdl->ma, ch, M75_R00, M75_SCC_WR00_RST_EXT_STAT );
-	WRITE_SCC_REG( llHdl->ma, ch, M75_R00, M75_SCC_WR00_RST_HIGH_IUS );
+	IWRITE_SCC_CMD2( llHdl->ma, ch, M75_SCC_WR00_RST_EXT_STAT,
+					 M75_SCC_WR00_RST_HIGH_IUS );
 
 	/* disable Break/Abort Int
 	 * to avoid an out of frame Break/Abort interrupt */
 	if( (breakAbortIEset = (llHdl->chan[ch].sccRegs.wr15 & M75_SCC_WR15_BREAK_ABORT_IE)) )
-		WRITE_SCC_REG( llHdl->ma, ch, M75_R15,
+		IWRITE_SCC_REG( llHdl->ma, ch, 15,
 					   llHdl->chan[ch].sccRegs.wr15 & ~M75_SCC_WR15_BREAK_ABORT_IE );
 
 
 	while( !rxEmpty ) { /* pick up all bytes already received */
-		if( (llHdl->chan[ch].rxQ.totEntries ==
-			   llHdl->chan[ch].rxQ.maxFrameNum) ||
-			  !llHdl->chan[ch].rxQ.qinit )
+		if( MQ_FULL(&llHdl->chan[ch].rxQ) || !llHdl->chan[ch].rxQ.qinit )
 		{
 			IDBGWRT_ERR((DBH, "   >>> ERR %s: Rx Error: M75_ERR_RX_QFULL\n", functionName));
+			llHdl->chan[ch].stats.rxQFull++;
 
 			/* count Rx FIFO entries */
 			llHdl->chan[ch].rxStatCnt++;
 
 			if( llHdl->chan[ch].rxStatCnt > 10 ) {
 				/* Rx Status FIFO overflowed */
+				llHdl->chan[ch].stats.rxStatOvfl++;
 
 				llHdl->chan[ch].rxERR = M75_ERR_RX_OVERFLOW;
 
 				/* disable receiver */
-				WRITE_SCC_REG( llHdl->ma, ch, M75_R03,
+				IWRITE_SCC_REG( llHdl->ma, ch, 03,
 								llHdl->chan[ch].sccRegs.wr03 & ~(M75_SCC_WR03_RX_EN) );
 				IDBGWRT_ERR((DBH, "   >>> ERR %s: Rx Error: Status FIFO overflow, receiver disabled\n", functionName));
 
 			} else if( !llHdl->chan[ch].rxERR ) {
 				llHdl->chan[ch].rxERR = M75_ERR_RX_QFULL;
 				/* tell me when next Char is received */
-				WRITE_SCC_REG( llHdl->ma, ch, M75_R00, M75_SCC_WR00_EN_INT_NXT_RX );
+				IWRITE_SCC_CMD( llHdl->ma, ch, M75_SCC_WR00_EN_INT_NXT_RX );
 			}
 
 			/* send semaphore if BlockRead is waiting for receive data */
@@ -2323,7 +4529,7 @@ static int32 M75_IrqRx_Data_Async(LL_HANDLE *llHdl, u_int32 ch){
 
 			/* enable Break/Abort interrupts again */
 			if( breakAbortIEset ){
-				WRITE_SCC_REG( llHdl->ma, ch, M75_R15,
+				IWRITE_SCC_REG( llHdl->ma, ch, 15,
 							   llHdl->chan[ch].sccRegs.wr15 | M75_SCC_WR15_BREAK_ABORT_IE);
 			}
 
@@ -2331,16 +4537,23 @@ static int32 M75_IrqRx_Data_Async(LL_HANDLE *llHdl, u_int32 ch){
 			return(llHdl->chan[ch].rxERR);
 		}
 
-		/* get special condition source */
-		READ_SCC_REG( llHdl->ma, ch, M75_R01, rr1 );
-		IDBGWRT_3((DBH, "   >>> %s: RR01 = 0x%02X\n", functionName, rr1));
+		/* get special condition source, in burst mode after the burst */
+		if( !burst ) {
+			IREAD_SCC_REG( llHdl->ma, ch, M75_R01, rr1 );
+			IDBGWRT_3((DBH, "   >>> %s: RR01 = 0x%02X\n", functionName, rr1));
+		}
 
 		if( llHdl->chan[ch].rxStatCnt )
 			llHdl->chan[ch].rxStatCnt--;
 
-		if(rr1 & (M75_SCC_RR01_ERR_RX_OVR | M75_SCC_RR01_ERR_CRC_FRM)) {
-			/* Rx Framing | Parity Error */
+		if(rr1 & (M75_SCC_RR01_ERR_RX_OVR | M75_SCC_RR01_ERR_CRC_FRM |
+				  M75_SCC_RR01_ERR_PAR)) {
+			/* Rx Framing | Parity | Overrun Error */
 			IDBGWRT_ERR((DBH, "   >>> ERR %s: Rx Error: RR1 = 0x%02X\n", functionName, rr1));
+			if( rr1 & (M75_SCC_RR01_ERR_CRC_FRM | M75_SCC_RR01_ERR_PAR) )
+				llHdl->chan[ch].stats.rxCrcErr++;
+			if( rr1 & M75_SCC_RR01_ERR_RX_OVR )
+				llHdl->chan[ch].stats.rxOverrun++;
 
 			if( !llHdl->chan[ch].rxERR ) /* don't overwrite Rx errors */
 				llHdl->chan[ch].rxERR = M75_ERR_RX_ERROR;
@@ -2363,7 +4576,7 @@ static int32 M75_IrqRx_Data_Async(LL_HANDLE *llHdl, u_int32 ch){
 
 			/* enable Break/Abort interrupts again */
 			if( breakAbortIEset ){
-				WRITE_SCC_REG( llHdl->ma, ch, M75_R15,
+				IWRITE_SCC_REG( llHdl->ma, ch, 15,
 							   llHdl->chan[ch].sccRegs.wr15 | M75_SCC_WR15_BREAK_ABORT_IE);
 			}
 
@@ -2373,54 +4586,143 @@ static int32 M75_IrqRx_Data_Async(LL_HANDLE *llHdl, u_int32 ch){
 		} else  {
 			/* data available */
 
-			/* put byte into buffer */
-			READ_SCC_REG( llHdl->ma, ch, M75_R08, retVal );
+			/* put byte into buffer, data register needs no pointer write */
+			retVal = MREAD_D8( llHdl->ma, DATA_REG_A+(ch<<1) );
 			IDBGWRT_5((DBH, "   >>> %s received byte %02x (buffer position %d)\n", functionName, (u_int8)retVal, rxEnt->size));
 
+			if( rxEnt->size == 0 ) {
+				rxEnt->tstamp = M75_TSTAMP_GET(llHdl);
+				llHdl->chan[ch].asyRxSigSent = FALSE;
+				llHdl->chan[ch].asyRxWoke = FALSE;
+			}
 			rxEnt->frame[rxEnt->size++] = retVal;
 			rxEnt->xfering = TRUE; /* mark queue entry as beeing filled */
 
+			/* wake reader when water mark is reached */
+			wake = ( rxEnt->size >= llHdl->chan[ch].asyRxSigWaterM );
+
 			/* update buffer */
 			if( rxEnt->size == llHdl->chan[ch].rxQ.maxFrameSize ) {
 				/* buffer full, finish it up */
-				rxEnt->ready   = TRUE;
+				M75_STAT_RX( llHdl, ch, rxEnt->size );
 				rxEnt->xfering = FALSE;
-				llHdl->chan[ch].rxQ.totEntries++;
-				llHdl->chan[ch].rxQ.last = llHdl->chan[ch].rxQ.last->next;
+				MQ_PUT(&llHdl->chan[ch].rxQ);
 				IDBGDMP_4((DBH, "Rx Data:", rxEnt->frame, rxEnt->size, 1));
+				rxEnt = llHdl->chan[ch].rxQ.last;
+				wake = TRUE;
 			}
 
-			/* send semaphore if BlockRead is waiting for receive data */
-			if( llHdl->chan[ch].rxQ.waiting ) {
-				IDBGWRT_3((DBH, "   >>> %s: wake read waiter\n", functionName));
-				llHdl->chan[ch].rxQ.waiting = FALSE;
-				OSS_SemSignal( llHdl->osHdl, llHdl->chan[ch].rxQ.sem );
-			}
-
-			/* Send Signal to application if enabled */
-			if( llHdl->chan[ch].sig && rxEnt->size == llHdl->chan[ch].asyRxSigWaterM ) {
-				IDBGWRT_3((DBH, "   >>> %s: send Rx ch %s signal to application\n", functionName, (ch==0)?"A":"B"));
-				OSS_SigSend( llHdl->osHdl, llHdl->chan[ch].sig );
-			}
-
+			if( wake )
+				M75_RxWake( llHdl, ch );
 		}
-		READ_SCC_REG( llHdl->ma, ch, M75_R00, rr0 );
+		IREAD_SCC_REG( llHdl->ma, ch, M75_R00, rr0 );
 		rxEmpty = !( rr0 & M75_SCC_RR00_RX_CHAR_AVAIL );
 		IDBGWRT_5((DBH, "   >>> %s: %smore data avail\n", functionName, rxEmpty ? "no " : ""));
+
+		if( rxEmpty && burst ) {
+			/* burst drained, overrun and parity errors are latched until
+			 * Error Reset, a framing error only if on the last character;
+			 * if any, loop once more to report them */
+			IREAD_SCC_REG( llHdl->ma, ch, M75_R01, rr1 );
+			IDBGWRT_3((DBH, "   >>> %s: RR01 = 0x%02X\n", functionName, rr1));
+			rxEmpty = !(rr1 & (M75_SCC_RR01_ERR_RX_OVR | M75_SCC_RR01_ERR_CRC_FRM |
+							   M75_SCC_RR01_ERR_PAR));
+		}
 	}
 	/* enable Break/Abort interrupts again */
 	if( breakAbortIEset ){
-		WRITE_SCC_REG( llHdl->ma, ch, M75_R15,
+		IWRITE_SCC_REG( llHdl->ma, ch, 15,
 					   llHdl->chan[ch].sccRegs.wr15 | M75_SCC_WR15_BREAK_ABORT_IE);
 	}
 
 	/* produce an Int on next Rx Char */
-	WRITE_SCC_REG( llHdl->ma, ch, M75_R00, M75_SCC_WR00_EN_INT_NXT_RX );
+	IWRITE_SCC_CMD( llHdl->ma, ch, M75_SCC_WR00_EN_INT_NXT_RX );
+
+	/* data below the water mark: wake reader when the line stays idle;
+	 * an rxAlarm already set measures from the last character itself */
+	llHdl->chan[ch].asyRxLast = M75_TSTAMP_GET(llHdl);
+	if( llHdl->chan[ch].asyRxIdle && rxEnt->xfering &&
+		!llHdl->chan[ch].asyRxArmed &&
+		( llHdl->chan[ch].rxQ.waiting ||
+		  ( llHdl->chan[ch].sig && !llHdl->chan[ch].asyRxSigSent ) ) ) {
+		if( OSS_AlarmSet( llHdl->osHdl, llHdl->chan[ch].rxAlarm,
+						  llHdl->chan[ch].asyRxIdle, 0, NULL ) ) {
+			IDBGWRT_ERR((DBH, "   >>> ERR %s: can't set rxAlarm\n", functionName));
+		} else {
+			llHdl->chan[ch].asyRxArmed = TRUE;
+		}
+	}
 
 	IDBGWRT_2((DBH, "   <<< %s\n", functionName));
 	return(ERR_SUCCESS);
 } /* M75_Rx_Frame_Async */
 
+/****************************** M75_RxWake ***********************************/
+/** Wake Rx waiter and send Rx signal in ASYNC mode
+ *
+ *  The signal is sent once per Rx queue entry.
+ *
+ *  \param llHdl  	   \IN  low-level handle
+ *  \param ch    	   \IN  channel
+ */
+static void M75_RxWake(
+	LL_HANDLE *llHdl,
+	u_int32 ch
+)
+{
+    DBGCMD( static const char functionName[] = "LL - M75_RxWake"; )
+
+	llHdl->chan[ch].asyRxWoke = TRUE;
+
+	/* send semaphore if BlockRead is waiting for receive data */
+	if( llHdl->chan[ch].rxQ.waiting ) {
+		IDBGWRT_3((DBH, "   >>> %s: wake read waiter\n", functionName));
+		llHdl->chan[ch].rxQ.waiting = FALSE;
+		OSS_SemSignal( llHdl->osHdl, llHdl->chan[ch].rxQ.sem );
+	}
+
+	/* Send Signal to application if enabled */
+	if( llHdl->chan[ch].sig && !llHdl->chan[ch].asyRxSigSent ) {
+		IDBGWRT_3((DBH, "   >>> %s: send Rx ch %s signal to application\n", functionName, (ch==0)?"A":"B"));
+		OSS_SigSend( llHdl->osHdl, llHdl->chan[ch].sig );
+		llHdl->chan[ch].asyRxSigSent = TRUE;
+	}
+} /* M75_RxWake */
+
+/****************************** M75_RxIdleAlarm ******************************/
+/** Alarm routine, Rx line idle for M75_ASY_RX_IDLE msec (ASYNC mode)
+ *
+ *  Wakes the reader for data below the water mark. If characters were
+ *  received since the alarm was set, it is set again for the rest of
+ *  the idle time after the last one.
+ *
+ *  \param arg         \IN  channel object
+ */
+static void M75_RxIdleAlarm(
+	void *arg
+)
+{
+	CHN_OBJ *chan = (CHN_OBJ*)arg;
+	LL_HANDLE *llHdl = chan->llHdl;
+	u_int32 left;
+	OSS_IRQ_STATE irqState;
+
+	irqState = OSS_IrqMaskR( llHdl->osHdl, llHdl->irqHdl );
+	chan->asyRxArmed = FALSE;
+	if( chan->rxQ.last->xfering ) {
+		left = M75_MsecLeft( llHdl, chan->asyRxLast, chan->asyRxIdle );
+		if( left ) {
+			/* line not idle long enough yet */
+			if( !OSS_AlarmSet( llHdl->osHdl, chan->rxAlarm, left, 0, NULL ) )
+				chan->asyRxArmed = TRUE;
+		} else {
+			M75_RxWake( llHdl, chan->num );
+			M75_EvCheck( llHdl );
+		}
+	}
+	OSS_IrqRestore( llHdl->osHdl, llHdl->irqHdl, irqState );
+} /* M75_RxIdleAlarm */
+
 /****************************** M75_Info *************************************/
 /** Get information about hardware and driver requirements
  *
@@ -2557,6 +4859,33 @@ static char* Ident( void )
     return( (char*) IdentString );
 }
 
+/****************************** M75_ChanAlarms *****************************/
+/** Fill the alarm table of a channel
+ *
+ *  Init creates, Exit clears and Cleanup removes the alarms in this order.
+ *
+ *  \param chP        \IN  channel object
+ *  \param alarm      \OUT M75_ALARM_NUM alarm routines and handles
+ */
+static void M75_ChanAlarms(
+	CHN_OBJ		*chP,
+	M75_ALARM	*alarm
+)
+{
+	alarm[0].funct = M75_TxFifoAlarm;	/* async: ext. Tx FIFO drained */
+	alarm[0].hdlP  = &chP->txAlarm;
+	alarm[1].funct = M75_RxIdleAlarm;	/* async: Rx idle time */
+	alarm[1].hdlP  = &chP->rxAlarm;
+	alarm[2].funct = M75_RxPollAlarm;	/* sync: Rx polling */
+	alarm[2].hdlP  = &chP->pollAlarm;
+	alarm[3].funct = M75_RxDeferAlarm;	/* sync: deferred Rx frame copy */
+	alarm[3].hdlP  = &chP->deferAlarm;
+	alarm[4].funct = M75_StormAlarm;	/* interrupt storm backoff */
+	alarm[4].hdlP  = &chP->stormAlarm;
+	alarm[5].funct = M75_RxSigAlarm;	/* sync: coalesced Rx signal */
+	alarm[5].hdlP  = &chP->sigAlarm;
+} /* M75_ChanAlarms */
+
 /********************************* Cleanup *********************************/
 /** Close all handles, free memory and return error code
  *
@@ -2572,7 +4901,8 @@ static int32 Cleanup(
    int32        retCode
 )
 {
-	u_int32 ch;
+	u_int32 ch, i;
+	M75_ALARM alarm[M75_ALARM_NUM];
     /*------------------------------+
     |  close handles                |
     +------------------------------*/
@@ -2587,15 +4917,29 @@ static int32 Cleanup(
     |  free memory, remove semaphores and signals  |
     +---------------------------------------------*/
 	for(ch = 0; ch<CH_NUMBER; ch++){
+		/* remove alarms first, their routines use the semaphores */
+		M75_ChanAlarms( &llHdl->chan[ch], alarm );
+		for( i=0; i<M75_ALARM_NUM; i++ )
+			if( *alarm[i].hdlP )
+				OSS_AlarmRemove( llHdl->osHdl, alarm[i].hdlP );
+
 		/* remove semaphores */
 		if( llHdl->chan[ch].rxQ.sem )
 			OSS_SemRemove( llHdl->osHdl, &llHdl->chan[ch].rxQ.sem );
 		if( llHdl->chan[ch].txQ.sem )
 			OSS_SemRemove( llHdl->osHdl, &llHdl->chan[ch].txQ.sem );
+		if( llHdl->chan[ch].txDrainSem )
+			OSS_SemRemove( llHdl->osHdl, &llHdl->chan[ch].txDrainSem );
 
 		if( llHdl->chan[ch].sig )
 			OSS_SigRemove( llHdl->osHdl,
 									&llHdl->chan[ch].sig );
+		if( llHdl->chan[ch].stormSig )
+			OSS_SigRemove( llHdl->osHdl,
+									&llHdl->chan[ch].stormSig );
+		if( llHdl->chan[ch].txSig )
+			OSS_SigRemove( llHdl->osHdl,
+									&llHdl->chan[ch].txSig );
 
 		/* free RxQ */
 		if( llHdl->chan[ch].rxQ.startAlloc ){
@@ -2612,6 +4956,11 @@ static int32 Cleanup(
 		}
 
 	}
+	if( llHdl->evSem )
+		OSS_SemRemove( llHdl->osHdl, &llHdl->evSem );
+	if( llHdl->evSig )
+		OSS_SigRemove( llHdl->osHdl, &llHdl->evSig );
+
     /* free my handle */
     OSS_MemFree(llHdl->osHdl, (int8*)llHdl, llHdl->memAlloc);
 
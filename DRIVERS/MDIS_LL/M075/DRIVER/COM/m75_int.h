@@ -146,6 +146,7 @@
 
 /* WR07 */
 #define M75_SCC_WR07P_TX_FIFO_EMPTY	0x20	/* Tx FIFO Empty */
+#define M75_SCC_WR07P_EXT_READ		0x40	/* Extended Read Enable */
 
 /* WR09 */
 #define M75_SCC_WR09_MIE			0x08	/* Master Interrupt Enable */
@@ -189,20 +190,43 @@
 #define M75_SCC_RR03_CHA_EXTSTAT_IP	0x08	/* Channel A Ext/Status Interrupt pending */
 #define M75_SCC_RR03_CHA_TX_IP		0x10	/* Channel A Tx Interrupt pending */
 #define M75_SCC_RR03_CHA_RX_IP		0x20	/* Channel A Rx Interrupt pending */
+/* IPs of one channel, shifted to bits 0..2 */
+#define M75_SCC_RR03_CH_IP(rr3,ch)	(((rr3) >> ((ch) ? 0 : 3)) & 0x07)
+#define M75_SCC_RR03_EXTSTAT_IP		0x01	/* Ext/Status Interrupt pending */
+#define M75_SCC_RR03_TX_IP			0x02	/* Tx Interrupt pending */
+#define M75_SCC_RR03_RX_IP			0x04	/* Rx Interrupt pending */
 
 /* RR07 */
 #define M75_SCC_RR07_BC_MASK		0x3F	/* Byte Count Mask */
 #define M75_SCC_RR07_FDA			0x40	/* FIFO Data Available */
 #define M75_SCC_RR07_FOS			0x80	/* FIFO Overflow Status */
 
+/* RR15 */
+#define M75_SCC_RR15_MASK			0xFA	/* WR15 bits readable in RR15 */
+
 /* other defines */
 #define M75_DELAY			100		/* Delay in msec */
 #define M75_SYNC_MODE		1		/* Default mode is SYNC */
 #define FRAME_NUM_DEF		0x010	/* Default maximum frame number */
 #define FRAME_SIZE_DEF		0x800	/* Default maximum frame size */
+#define M75_RX_POLL_LO_DEF	100		/* Default Rx frames/sec to leave polling */
+#define M75_RX_POLL_MSEC_DEF 10		/* Default Rx poll interval (msec) */
+#define M75_RX_PEND_NUM		16		/* Rx status entries pending for M75_RX_DEFER */
+#define M75_STORM_LOOPS_DEF	100		/* Default max. RR03 passes per ISR call */
+#define M75_STORM_MSEC_DEF	100		/* Default storm backoff (msec) */
+#define M75_TX_DONE_NUM		64		/* Tx completions kept for M75_BLK_TX_DONE */
+#define M75_EV_MASK_DEF		(M75_EV_CH(0, M75_EV_RX | M75_EV_ERR) | \
+							 M75_EV_CH(1, M75_EV_RX | M75_EV_ERR))
+									/* Default readiness events of interest */
 #define GETSETBLOCK_TOUT	0x000	/* Default maximum frame size */
 #define M75_WR01_MASK_INT	0x1F	/* Mask IEs in WR01 */
 #define M75_WR15_MASK_INT	0xFA	/* Mask Ext/Status IEs in WR15 */
+#define M75_PCLK			14745600 /* SCC PCLK, BR generator input [Hz] */
+
+/* async Tx through the external Tx FIFO (M75_ASY_TX_FIFO) */
+#define M75_TXF_IDLE		0		/* external Tx FIFO not used */
+#define M75_TXF_LOAD		1		/* entry being loaded into Tx FIFO */
+#define M75_TXF_DRAIN		2		/* waiting for Tx FIFO to drain */
 
 #ifdef M75_SUPPORT_BREAK_ABORT
 	#define M75_WR15_EN_INT	(M75_SCC_WR15_TX_UNDR_EOM_IE | M75_SCC_WR15_BREAK_ABORT_IE)	/* Interrupts to be enabled */
@@ -265,6 +289,45 @@
 		IDBGWRT_5( (DBH, "Read  ch %d SCC Reg %02d: %02X\n", ch, reg, val) ); \
     } while( 0 )
 
+/* Macros for accessing SCC registers with interrupts already masked (ISR,
+ * OSS_IrqMaskR section): no nested masking, the mirror is written directly.
+ * The register pointer is back at 0 after every access, so WR00/RR00 need
+ * no pointer write. */
+#define SCC_COMM_OFF( ch )	(COMM_REG_A + ((ch)<<1))
+
+/* write WRnn, n as two digits (not 07/08), and its mirror sccRegs.wrnn */
+#define IWRITE_SCC_REG( ma,ch,n,val )								\
+	do {															\
+		u_int8 valIAcc = (u_int8)(val);								\
+		MWRITE_D8( ma, SCC_COMM_OFF(ch), M75_R##n );				\
+		MWRITE_D8( ma, SCC_COMM_OFF(ch), valIAcc );					\
+		llHdl->chan[ch].sccRegs.wr##n = valIAcc;					\
+		IDBGWRT_5( (DBH, "IWrite ch %d SCC Reg " #n ": %02X\n", ch, valIAcc) ); \
+    } while( 0 )
+
+/* WR00 command */
+#define IWRITE_SCC_CMD( ma,ch,cmd )									\
+	do {															\
+		MWRITE_D8( ma, SCC_COMM_OFF(ch), cmd );						\
+		IDBGWRT_5( (DBH, "IWrite ch %d SCC Cmd %02X\n", ch, cmd) );	\
+    } while( 0 )
+
+/* two WR00 commands back-to-back, e.g. reset source IP and highest IUS */
+#define IWRITE_SCC_CMD2( ma,ch,cmd1,cmd2 )							\
+	do {															\
+		MWRITE_D8( ma, SCC_COMM_OFF(ch), cmd1 );					\
+		MWRITE_D8( ma, SCC_COMM_OFF(ch), cmd2 );					\
+		IDBGWRT_5( (DBH, "IWrite ch %d SCC Cmd %02X %02X\n", ch, cmd1, cmd2) ); \
+    } while( 0 )
+
+#define IREAD_SCC_REG( ma,ch,reg,val )								\
+	do {															\
+		if( (reg) != M75_R00 )										\
+			MWRITE_D8( ma, SCC_COMM_OFF(ch), reg );					\
+		val = MREAD_D8( ma, SCC_COMM_OFF(ch) );						\
+		IDBGWRT_5( (DBH, "IRead  ch %d SCC Reg %02d: %02X\n", ch, reg, val) ); \
+    } while( 0 )
+
 /** Macro to unlock device semaphore */
 #define DEVSEM_UNLOCK(llHdl) \
  if( llHdl->devSemHdl ) OSS_SemSignal( llHdl->osHdl, llHdl->devSemHdl );
@@ -279,9 +342,105 @@
      } while( error == ERR_OSS_SIG_OCCURED );\
  }
 
+/*
+ * Rx/Tx queues are single producer/single consumer rings:
+ * the producer only writes last/putCnt, the consumer only first/getCnt.
+ * Entry data must be visible before the counter update, M75_MB() orders it.
+ * Define M75_MB in the makefile for compilers other than gcc, as an empty
+ * macro on single CPU targets.
+ * The two sides are separated by padding of a full cache line, not by
+ * aligning MQUEUE_HEAD: the LL handle comes from OSS_MemGet(), which
+ * doesn't guarantee cache line alignment. A full line between them keeps
+ * the counters of both sides in different lines at any address.
+ */
+#ifndef M75_CACHE_LINE
+# define M75_CACHE_LINE		64	/**< separates producer/consumer data */
+#endif
+
+#ifndef M75_MB
+# if defined(__GNUC__)
+#  define M75_MB()			__sync_synchronize()
+# else
+#  error "M75_MB() not defined for this compiler, define it in the makefile"
+# endif
+#endif
+
+/*
+ * Rx frame timestamp source, default is the OSS tick counter.
+ * Define both macros in the makefile to use a finer platform timer.
+ */
+#ifndef M75_TSTAMP_GET
+# define M75_TSTAMP_GET(llHdl)	OSS_TickGet( (llHdl)->osHdl )
+# define M75_TSTAMP_FREQ(llHdl)	OSS_TickRateGet( (llHdl)->osHdl )
+#endif
+
+/** count value in log2 histogram with num bins */
+#define M75_HIST_LOG2( hist,val,num )					\
+	do {												\
+		u_int32 valH = (val) >> 1, bin = 0;				\
+		while( valH && bin < (num)-1 ) {				\
+			valH >>= 1;									\
+			bin++;										\
+		}												\
+		(hist)[bin]++;									\
+	} while( 0 )
+
+/** count frame size in statistics histogram */
+#define M75_STAT_HIST( hist,size ) \
+	M75_HIST_LOG2( hist, size, M75_STATS_HIST_NUM )
+
+/** count received frame in statistics */
+#define M75_STAT_RX( llHdl,ch,size )					\
+	do {												\
+		(llHdl)->chan[ch].stats.rxFrames++;				\
+		(llHdl)->chan[ch].stats.rxBytes += (size);		\
+		M75_STAT_HIST( (llHdl)->chan[ch].stats.rxSizeHist, size ); \
+	} while( 0 )
+
+/** count transmitted frame in statistics */
+#define M75_STAT_TX( llHdl,ch,size )					\
+	do {												\
+		(llHdl)->chan[ch].stats.txFrames++;				\
+		(llHdl)->chan[ch].stats.txBytes += (size);		\
+		M75_STAT_HIST( (llHdl)->chan[ch].stats.txSizeHist, size ); \
+	} while( 0 )
+
+/** number of entries in queue */
+#define MQ_CNT(q)		((u_int32)((q)->putCnt - (q)->getCnt))
+/** queue empty */
+#define MQ_EMPTY(q)		((q)->putCnt == (q)->getCnt)
+/** queue full */
+#define MQ_FULL(q)		(MQ_CNT(q) >= (q)->maxFrameNum)
+
+/** pending Rx status list full (M75_RX_DEFER) */
+#define RX_PEND_FULL(c)	((u_int32)((c)->rxPendPut - (c)->rxPendGet) >= M75_RX_PEND_NUM)
+
+/** Producer: pass entry at last to consumer (entry data written before) */
+#define MQ_PUT(q)								\
+	do {										\
+		M75_MB();								\
+		(q)->last = (q)->last->next;			\
+		(q)->putCnt++;							\
+	} while( 0 )
+
+/** Consumer: return entry at first to producer (entry data read before) */
+#define MQ_GET(q)								\
+	do {										\
+		M75_MB();								\
+		(q)->first = (q)->first->next;			\
+		(q)->getCnt++;							\
+	} while( 0 )
+
 /*-----------------------------------------+
 |  TYPEDEFS                                |
 +-----------------------------------------*/
+/** ll handle, declared here since the channel objects use types of
+ *  m75_drv.h, which in turn needs the jump table of ll_entry.h */
+typedef struct m75_ll_handle LL_HANDLE;
+
+/* include files which need LL_HANDLE */
+#include <MEN/ll_entry.h>   /* low-level driver jump table  */
+#include <MEN/m75_drv.h>   /* M75 driver header file */
 
 /** mirror of SCC Register Set object structure */
 typedef struct {
@@ -310,25 +469,44 @@ typedef struct mqueue_ent {
 	struct mqueue_ent	*next;		/**< ptr to next entry */
 	u_int8				*frame;		/**< tx/rx frame data */
 	u_int32				size;		/**< tx/rx frame size (bytes) */
-	u_int8				ready;		/**< flag if frame is ready for sending */
-	u_int8				xfering;	/**< flag if frame is just beeing sent/received */
+	u_int32				tstamp;		/**< rx: arrival time of frame, tx: queued */
+	u_int32				id;			/**< tx: frame id (M75_TX_ID) */
+	u_int32				xfering;	/**< async: entry partly sent/received */
 } MQUEUE_ENT;
 
 /** queue header structure */
 typedef struct {
+	/* consumer side */
 	MQUEUE_ENT 	*first;			/**< next entry to read */
+	volatile u_int32 getCnt;	/**< entries read (free running) */
+	u_int8		consPad[M75_CACHE_LINE];
+	/* producer side */
 	MQUEUE_ENT  *last;			/**< last entry, attach here */
+	volatile u_int32 putCnt;	/**< entries written (free running) */
+	u_int8		prodPad[M75_CACHE_LINE];
 	void		*startAlloc;	/**< pointer to start of queue memory */
 	OSS_SEM_HANDLE *sem;		/**< semaphore to wake read/write waiter */
-	u_int32		totEntries;		/**< total number of entries */
+	u_int8		*directBuf;		/**< Rx: buffer of waiting reader (M75_RX_DIRECT) */
+	u_int32		directSize;		/**< Rx: size of directBuf */
+	u_int32		directGot;		/**< Rx: bytes delivered into directBuf */
+	u_int32		directTstamp;	/**< Rx: arrival time of frame in directBuf */
 	u_int32		memAlloc;		/**< size of memory allocated in this queue  */
 	u_int32		maxFrameSize;	/**< maximum frame size in buffer */
 	u_int32		maxFrameNum;	/**< max. number of frames buffered by driver */
 	u_int8		errSent;		/**< flags if overrun error has been sent */
 	u_int8		qinit;			/**< flags if queue is ready initialized */
 	u_int8		waiting;		/**< flags read/write waiter waiting  */
+	u_int8		directDone;		/**< Rx: flags frame delivered into directBuf */
 } MQUEUE_HEAD;
 
+/** Rx status FIFO entry, frame data not read yet (M75_RX_DEFER) */
+typedef struct {
+	u_int32		size;			/**< frame size (bytes) */
+	u_int32		tstamp;			/**< arrival time of frame */
+	u_int8		rr1;			/**< RR01 of status entry */
+	u_int8		rr7;			/**< RR07 of status entry */
+} RX_PEND;
+
 /** per channel object structure */
 typedef struct {
 	MQUEUE_HEAD		rxQ;			/**< Receive queue header */
@@ -344,10 +522,69 @@ typedef struct {
 	u_int8		txUnderrEOMgot;	/**< flags if Tx Under/EOM int received */
 	u_int8		txBufEmpty;		/**< flags if Tx Buffer Empty int received */
 	u_int8		rxStatCnt;		/**< counter for Status FIFO entries on HW */
+	u_int8		rxDirect;		/**< flags direct Rx delivery enabled (M75_RX_DIRECT) */
+	u_int8		txDirect;		/**< flags direct Tx from user buffer (M75_TX_DIRECT) */
+	u_int8		rxBatch;		/**< flags batched M_getblock (M75_RX_BATCH) */
+	u_int8		txBatch;		/**< flags batched M_setblock (M75_TX_BATCH) */
+	u_int32		txBatchCnt;		/**< frames queued by last batched M_setblock */
+	u_int8		rxTstamp;		/**< flags timestamped M_getblock (M75_RX_TSTAMP) */
+	u_int8		regCached;		/**< flags SCC_REG GetStats from mirror (M75_REG_CACHED) */
+	u_int8		asyTxFifo;		/**< flags async Tx through ext. FIFO (M75_ASY_TX_FIFO) */
+	u_int8		txFifoSt;		/**< async: state of ext. Tx FIFO (M75_TXF_xxx) */
+	u_int8		asyRxBurst;		/**< flags async Rx errors checked per burst (M75_ASY_RX_BURST) */
+	u_int32		asyRxIdle;		/**< async: Rx idle time (msec) to wake reader (M75_ASY_RX_IDLE) */
+	u_int8		asyRxSigSent;	/**< async: Rx signal sent for current queue entry */
+	u_int8		asyRxWoke;		/**< async: reader woken for current queue entry */
+	u_int8		asyRxArmed;		/**< async: rxAlarm set */
+	u_int32		asyRxLast;		/**< async: time of last Rx character (timestamp) */
+	OSS_ALARM_HANDLE *txAlarm;	/**< async: checks ext. Tx FIFO drained */
+	OSS_ALARM_HANDLE *rxAlarm;	/**< async: Rx idle timer */
+	u_int32		rxPollHi;		/**< sync: Rx irqs/sec to switch to polling (M75_RX_POLL_HI) */
+	u_int32		rxPollLo;		/**< sync: Rx frames/sec to switch back (M75_RX_POLL_LO) */
+	u_int32		rxPollMsec;		/**< sync: Rx poll interval (M75_RX_POLL_MSEC) */
+	u_int8		rxPolling;		/**< sync: flags Rx polling mode */
+	u_int8		rxPollArmed;	/**< sync: pollAlarm set */
+	u_int32		rxPollCnt;		/**< sync: Rx irqs/frames in rate window */
+	u_int32		rxPollWin;		/**< sync: start of rate window (timestamp) */
+	u_int32		rxModeStart;	/**< start of current Rx mode (timestamp) */
+	OSS_ALARM_HANDLE *pollAlarm;/**< sync: Rx poll timer */
+	u_int8		rxDefer;		/**< sync: flags deferred Rx frame copy (M75_RX_DEFER) */
+	u_int8		rxPendArmed;	/**< sync: deferAlarm set for pending entries */
+	u_int8		rxPendFull;		/**< sync: Rx interrupt off, pending list full */
+	RX_PEND		rxPend[M75_RX_PEND_NUM]; /**< sync: status entries for deferAlarm */
+	volatile u_int32 rxPendPut;	/**< entries put by ISR (free running) */
+	volatile u_int32 rxPendGet;	/**< entries read by deferAlarm (free running) */
+	OSS_ALARM_HANDLE *deferAlarm;/**< sync: deferred Rx frame copy */
+	u_int32		rxBudget;		/**< sync: max. frames per Rx IP service (M75_RX_BUDGET) */
+	u_int32		rxSigFrames;	/**< sync: frames per Rx signal (M75_RX_SIG_FRAMES) */
+	u_int32		rxSigUsec;		/**< sync: max. Rx signal delay (M75_RX_SIG_USEC) */
+	u_int32		rxSigCnt;		/**< sync: frames received since last Rx signal */
+	u_int32		rxSigFirst;		/**< sync: time of first of them (timestamp) */
+	u_int8		rxSigArmed;		/**< sync: sigAlarm set */
+	OSS_ALARM_HANDLE *sigAlarm;	/**< sync: sends coalesced Rx signal */
+	OSS_SIG_HANDLE	*stormSig;	/**< interrupt storm signal installed */
+	u_int8		stormMask;		/**< WR01 IE bits disabled by storm detection */
+	u_int32		stormCnt;		/**< interrupts in storm rate window */
+	u_int32		stormWin;		/**< start of storm rate window (timestamp) */
+	OSS_ALARM_HANDLE *stormAlarm;/**< storm backoff, enables sources again */
+	u_int32		txId;			/**< id of last frame accepted (M75_TX_ID) */
+	u_int8		txOnWire;		/**< sync: frame txWireId started, no EOM yet */
+	u_int8		txEomClaimed;	/**< sync: EOM taken from RR00 by M75_TxClaim_Sync() */
+	u_int32		txWireId;		/**< sync: id of frame being sent */
+	u_int32		txWireQ;		/**< sync: time frame txWireId was queued */
+	M75_TX_DONE	txDone[M75_TX_DONE_NUM]; /**< sync: Tx completions */
+	volatile u_int32 txDonePut;	/**< completions put by ISR (free running) */
+	volatile u_int32 txDoneGet;	/**< completions read (free running) */
+	OSS_SIG_HANDLE	*txSig;		/**< Tx completion signal installed */
+	OSS_SEM_HANDLE	*txDrainSem;/**< wakes M75_TX_DRAIN waiter */
+	u_int8		txDrainWait;	/**< flags M75_TX_DRAIN waiter */
+	LL_HANDLE	*llHdl;			/**< back pointer for alarm routines */
+	u_int32		num;			/**< channel number */
+	M75_STATS	stats;			/**< statistics, updated with IRQs masked or in ISR */
 } CHN_OBJ;
 
 /** ll handle */
-typedef struct {
+struct m75_ll_handle {
 	/* general */
     int32           memAlloc;		/**< size allocated for the handle */
     OSS_HANDLE      *osHdl;         /**< oss handle */
@@ -365,14 +602,23 @@ typedef struct {
 	u_int8			irqEnabled;		/**< flags global interrupts enabled
 	                                  *  (M_MK_IRQ_ENABLE) */
 	u_int32			irqCount;		/**< number of irqs occurred  */
+	u_int32			irqFirstCh;		/**< channel served first in next RR03 pass */
+	u_int32			stormLoops;		/**< max. RR03 passes per ISR call (M75_STORM_LOOPS) */
+	u_int32			stormRate;		/**< max. irqs/sec per channel (M75_STORM_RATE) */
+	u_int32			stormMsec;		/**< storm backoff (M75_STORM_MSEC) */
+	u_int32			evMask;			/**< readiness events of interest (M75_EV_MASK) */
+	OSS_SEM_HANDLE	*evSem;			/**< wakes M75_EV_WAIT waiter */
+	OSS_SIG_HANDLE	*evSig;			/**< readiness signal (M75_SETEVSIG) */
+	u_int8			evWait;			/**< flags M75_EV_WAIT waiter blocked */
+	u_int8			evBusy;			/**< M75_EV_WAIT in progress (one waiter only) */
+	u_int8			evArmed;		/**< evSig not sent since last M75_EV_STATE */
 
 	u_int32			idCheck;		/**< ID PROM check enabled */
-	u_int32			maxIrqTime;
-} LL_HANDLE;
-
-/* include files which need LL_HANDLE */
-#include <MEN/ll_entry.h>   /* low-level driver jump table  */
-#include <MEN/m75_drv.h>   /* M75 driver header file */
+	u_int32			maxIrqTime;		/**< longest ISR duration (M75_IRQ_STATS) */
+#ifdef M75_IRQ_STATS
+	M75_IRQSTATS	irqStats;		/**< ISR statistics */
+#endif
+};
 
 
 /*--------------------------------------+
@@ -0,0 +1,753 @@
+/****************************************************************************
+ ************                                                    ************
+ ************                    M75_BENCH                       ************
+ ************                                                    ************
+ ****************************************************************************/
+/*!
+ *         \file m75_bench.c
+ *
+ *       \brief  Throughput and latency benchmark for the M75 driver
+ *
+ *               The program keeps the Tx queue of one or both channels
+ *               filled and receives the frames at the same time, either on
+ *               the same channel (loopback, see m75_endtest for the clock
+ *               wiring) or on the other channel (cross cable).
+ *               Every frame carries a sequence number and its transmit
+ *               time, so loss, reordering and the end-to-end latency
+ *               (M_setblock to M_getblock) can be measured.
+ *
+ *               Since the UOS library provides no threads, Tx and Rx are
+ *               interleaved in a single loop using non-blocking
+ *               M_setblock/M_getblock calls. The latency resolution is that
+ *               of UOS_MsecTimerGet(). With -e the loop sleeps in
+ *               M75_EV_WAIT until a channel is ready instead of polling.
+ *
+ *     Required: libraries: mdis_api, usr_oss, usr_utl
+ *     \switches (none)
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2004-2019, MEN Mikro Elektronik GmbH
+ ****************************************************************************/
+/*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <MEN/men_typs.h>
+#include <MEN/usr_oss.h>
+#include <MEN/usr_utl.h>
+#include <MEN/mdis_api.h>
+#include <MEN/mdis_err.h>
+#include <MEN/m75_drv.h>
+
+
+/*--------------------------------------+
+|   DEFINES                             |
++--------------------------------------*/
+#define EXT_FIFO_SIZE	0x800
+#define CH_NUM			2
+#define SCC_PCLK		14745600	/* SCC clock [Hz] */
+#define CRC_SIZE		2			/* CRC bytes appended to Rx frames */
+#define FLAG_SIZE		1			/* flag between frames on the wire */
+
+/* payload header */
+#define HDR_MAGIC0		0x75
+#define HDR_MAGIC1		0xBE
+#define HDR_SIZE		12			/* magic, chan, rsvd, seq, tx time */
+
+/*--------------------------------------+
+|   TYPDEFS                             |
++--------------------------------------*/
+/* Tx side of a channel and the frames received from it */
+typedef struct {
+	int32		active;		/* channel transmits */
+	int32		rxChan;		/* channel receiving the frames */
+	u_int32		txSeq;		/* next sequence number to send */
+	u_int32		rxNum;		/* frames received (incl. duplicates) */
+	u_int32		rxBytes;	/* payload bytes received */
+	u_int32		rxNextSeq;	/* highest sequence number received + 1 */
+	u_int32		reord;		/* frames received after a later one */
+	u_int32		dup;		/* frames received twice */
+	u_int32		dataErr;	/* frames with bad size or content */
+	u_int32		rxErr;		/* M_getblock errors */
+	u_int32		txErr;		/* M_setblock errors */
+	int32		txFull;		/* last M_setblock found the Tx queue full */
+	u_int8		*seen;		/* per sequence number: frame received */
+	u_int32		*lat;		/* latency of received frames [ms] */
+	u_int32		latNum;		/* entries in lat */
+	u_int32		startTime;	/* first M_setblock [ms] */
+	u_int32		endTime;	/* last frame received [ms] */
+} BENCH_CHAN;
+
+/*--------------------------------------+
+|   EXTERNALS                           |
++--------------------------------------*/
+/* none */
+
+/*--------------------------------------+
+|   GLOBALS                             |
++--------------------------------------*/
+/* none */
+
+/*--------------------------------------+
+|   PROTOTYPES                          |
++--------------------------------------*/
+static void PrintError(char *info);
+static void SigHandler( u_int32 sigCode );
+static void usage(void);
+static int32 ChanConfig( MDIS_PATH path, int32 chan, int32 tconst, int32 rfio,
+						 int32 lloop, int32 qdepth );
+static void FrameBuild( u_int8 *buf, int32 size, int32 chan, u_int32 seq );
+static int32 FrameCheck( BENCH_CHAN *bc, int32 chan, u_int8 *buf,
+						 int32 len, int32 size, int32 fnumber );
+static int LatCmp( const void *a, const void *b );
+static u_int32 LatPerc( BENCH_CHAN *bc, u_int32 permille );
+static u_int32 RateCalc( u_int32 num, u_int32 msec, u_int32 scale );
+static void DrvStatsPrint( MDIS_PATH path, int32 chan, int32 machine );
+
+/********************************* usage ************************************
+ *
+ *  Description: Print program usage
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: -
+ *  Output.....: -
+ *  Globals....: -
+ ****************************************************************************/
+static void usage(void)
+{
+	printf("\n");
+	printf("Syntax: m75_bench <device> [options]\n");
+	printf("Function:\n");
+	printf("  M75 full-duplex throughput and latency benchmark (SDLC)\n");
+	printf("  Keeps the Tx queues filled and receives at the same time,\n");
+	printf("  reports frames/s, payload Mbit/s vs. wire rate, loss,\n");
+	printf("  reordering and latency (M_setblock to M_getblock)\n");
+	printf("  Rx and Tx clock must match (see m75_endtest)\n");
+	printf("Parameters:\n");
+	printf("    device       device name\n");
+	printf("Options:\n");
+	printf("    -c=<chan>    transmitting channel (0/1), 2=both  [0]\n");
+	printf("    -x           cross: frames received on other\n");
+	printf("                 channel                             [same]\n");
+	printf("    -t=<tconst>  BR Gen timeconstant (hex)           [5]\n");
+	printf("    -s=<fsize>   size of frames (bytes, %d..%d)     [256]\n",
+		   HDR_SIZE, EXT_FIFO_SIZE-CRC_SIZE);
+	printf("    -n=<fnum>    number of frames per channel        [1000]\n");
+	printf("    -q=<qnum>    Rx/Tx queue depth (frames)          [16]\n");
+	printf("    -w=<wnum>    max. frames in flight per channel   [qnum]\n");
+	printf("    -o=<msec>    stop when no progress for <msec>    [1000]\n");
+	printf("    -e           event loop: wait for ready channels\n");
+	printf("                 (M75_EV_WAIT)                       [poll]\n");
+	printf("    -g=<frames>  install Rx signal, sent every <frames>\n");
+	printf("                 frames (M75_RX_SIG_FRAMES)          [none]\n");
+	printf("    -u=<usec>    max. Rx signal delay (M75_RX_SIG_USEC) [0]\n");
+	printf("    -l           enable local loopback\n");
+	printf("    -r           select rear I/O                     [front]\n");
+	printf("    -m           machine readable output (key=value)\n");
+	printf("    -v           flag to print verbose debug messages\n");
+	printf("\n");
+}
+
+/********************************* main ************************************/
+/** Program main function
+ *
+ *  \param argc       \IN  argument counter
+ *  \param argv       \IN  argument vector
+ *
+ *  \return	          success (0) or error (1)
+ */
+int main(int argc, char *argv[])
+{
+	MDIS_PATH	path[CH_NUM];
+	BENCH_CHAN	bch[CH_NUM], *bc;
+	int32	chanSel, tconst, fsize, fnumber, qdepth, window, idleTout,
+			cross, lloop, rfio, machine, verbose, evloop, evMask,
+			sigFrames, sigUsec, sigOn=0,
+			ch, src, n, progress, done, aborted=0, error=0, syserror;
+	u_int32	bitrate, lastProgress, now, msec, kbps, wireKbps, fps;
+	char	*device, *str, *errstr, errbuf[80];
+	u_int8	txBuffer[EXT_FIFO_SIZE], rxBuffer[EXT_FIFO_SIZE];
+
+	if (argc < 2 || strcmp(argv[1],"-?")==0) {
+		usage();
+		return(1);
+	}
+
+	if( (errstr = UTL_ILLIOPT("c=xt=s=n=q=w=o=eg=u=lrmv?", errbuf)) ) {
+		printf("%s\n", errstr);
+		return(1);
+	}
+
+	device	= argv[1];
+	chanSel	= ((str = UTL_TSTOPT("c=")) ? atoi(str) : 0);
+	tconst	= ((str = UTL_TSTOPT("t=")) ? strtol(str, NULL, 16) : 5);
+	fsize	= ((str = UTL_TSTOPT("s=")) ? atoi(str) : 256);
+	fnumber	= ((str = UTL_TSTOPT("n=")) ? atoi(str) : 1000);
+	qdepth	= ((str = UTL_TSTOPT("q=")) ? atoi(str) : 16);
+	window	= ((str = UTL_TSTOPT("w=")) ? atoi(str) : qdepth);
+	idleTout= ((str = UTL_TSTOPT("o=")) ? atoi(str) : 1000);
+	cross	= ((str = UTL_TSTOPT("x")) ? 1 : 0);
+	evloop	= ((str = UTL_TSTOPT("e")) ? 1 : 0);
+	sigFrames = ((str = UTL_TSTOPT("g=")) ? atoi(str) : -1);
+	sigUsec	= ((str = UTL_TSTOPT("u=")) ? atoi(str) : 0);
+	lloop	= ((str = UTL_TSTOPT("l")) ? 1 : 0);
+	rfio	= ((str = UTL_TSTOPT("r")) ? 1 : 0);
+	machine	= ((str = UTL_TSTOPT("m")) ? 1 : 0);
+	verbose	= ((str = UTL_TSTOPT("v")) ? 1 : 0);
+
+	if( chanSel < 0 || chanSel > CH_NUM || tconst < 0 || tconst > 0xffff ||
+		fsize < HDR_SIZE || fsize > EXT_FIFO_SIZE-CRC_SIZE ||
+		fnumber < 1 || qdepth < 1 || window < 1 || idleTout < 1 ||
+		sigUsec < 0 ||
+		(cross && lloop) ) {
+		usage();
+		return(1);
+	}
+
+	/* SDLC clock mode x1: bit rate = PCLK / (2 * (tconst + 2)) */
+	bitrate = SCC_PCLK / (2 * (tconst + 2));
+	/* payload rate on a saturated wire (bit stuffing ignored) */
+	wireKbps = (bitrate / 1000) * fsize / (fsize + CRC_SIZE + FLAG_SIZE);
+
+	/*--------------------+
+    |  open paths         |
+    +--------------------*/
+	memset( bch, 0, sizeof(bch) );
+	for( ch=0; ch<CH_NUM; ch++ ){
+		path[ch] = -1;
+		bch[ch].active = (chanSel == CH_NUM || chanSel == ch);
+	}
+
+	for( ch=0; ch<CH_NUM; ch++ ){
+		if( !bch[ch].active )
+			continue;
+		bch[ch].rxChan = cross ? ch ^ 1 : ch;
+		bch[ch].seen   = (u_int8*)calloc( fnumber, sizeof(u_int8) );
+		bch[ch].lat	   = (u_int32*)malloc( fnumber * sizeof(u_int32) );
+		if( !bch[ch].seen || !bch[ch].lat ){
+			printf("*** ERROR can't allocate %d frame entries\n", fnumber);
+			goto abort;
+		}
+	}
+
+	for( ch=0; ch<CH_NUM; ch++ ){
+		/* the channel transmits or receives */
+		if( !bch[ch].active && !(cross && bch[ch^1].active) )
+			continue;
+
+		if( (path[ch] = M_open(device)) < 0 ) {
+			PrintError("open");
+			goto abort;
+		}
+		if( ChanConfig( path[ch], ch, tconst, rfio, lloop, qdepth ) )
+			goto abort;
+	}
+
+	/* Rx signals, the driver counts them in M75_STATS rxSig */
+	if( sigFrames >= 0 ){
+		UOS_SigInit( SigHandler );
+		sigOn = 1;
+		for( ch=0; ch<CH_NUM; ch++ ){
+			if( path[ch] < 0 )
+				continue;
+			if( UOS_SigInstall( ch ? UOS_SIG_USR2 : UOS_SIG_USR1 ) ||
+				M_setstat( path[ch], M75_RX_SIG_FRAMES, sigFrames ) ||
+				M_setstat( path[ch], M75_RX_SIG_USEC, sigUsec ) ||
+				M_setstat( path[ch], M75_SETRXSIG,
+						   ch ? UOS_SIG_USR2 : UOS_SIG_USR1 ) ){
+				PrintError("setstat M75_SETRXSIG");
+				goto abort;
+			}
+		}
+	}
+
+	if( !machine ){
+		printf("m75_bench: %s, tconst 0x%x (%d bit/s), frame %d bytes, "
+			   "%d frames, queue %d, window %d\n",
+			   device, tconst, bitrate, fsize, fnumber, qdepth, window);
+	}
+
+	/*--------------------+
+    |  run                |
+    +--------------------*/
+	lastProgress = UOS_MsecTimerGet();
+	done = 0;
+
+	while( !done ){
+		progress = 0;
+
+		/* fill Tx queues up to the window */
+		for( ch=0; ch<CH_NUM; ch++ ){
+			bc = &bch[ch];
+			if( !bc->active )
+				continue;
+
+			while( bc->txSeq < (u_int32)fnumber &&
+				   bc->txSeq - bc->rxNextSeq < (u_int32)window ){
+				now = UOS_MsecTimerGet();
+				if( bc->txSeq == 0 )
+					bc->startTime = now;
+				FrameBuild( txBuffer, fsize, ch, bc->txSeq );
+				memcpy( &txBuffer[8], &now, sizeof(now) );
+
+				if( M_setblock( path[ch], txBuffer, fsize ) != fsize ){
+					syserror = UOS_ErrnoGet();
+					bc->txFull = (syserror == M75_ERR_TX_QFULL);
+					if( syserror != M75_ERR_TX_QFULL ){
+						bc->txErr++;
+						if( verbose )
+							printf("*** ERROR M_setblock(ch %d, seq %d) ***\n"
+								   "*** %s\n", ch, bc->txSeq,
+								   M_errstring( syserror ));
+					}
+					break;
+				}
+				bc->txSeq++;
+				bc->txFull = 0;
+				progress++;
+			}
+		}
+
+		/* drain Rx queues */
+		for( ch=0; ch<CH_NUM; ch++ ){
+			src = cross ? ch ^ 1 : ch;
+			if( path[ch] < 0 || !bch[src].active )
+				continue;
+
+			for(;;){
+				n = M_getblock( path[ch], rxBuffer, sizeof(rxBuffer) );
+				if( n < 0 ){
+					syserror = UOS_ErrnoGet();
+					if( syserror == M75_ERR_RX_QEMPTY )
+						break;
+					bch[src].rxErr++;
+					progress++;
+					if( verbose )
+						printf("*** ERROR M_getblock(ch %d) ***\n*** %s\n",
+							   ch, M_errstring( syserror ));
+					continue;
+				}
+				FrameCheck( &bch[src], src, rxBuffer, n, fsize, fnumber );
+				progress++;
+			}
+		}
+
+		/* finished, stalled or aborted? */
+		now  = UOS_MsecTimerGet();
+		done = 1;
+		for( ch=0; ch<CH_NUM; ch++ )
+			if( bch[ch].active && bch[ch].rxNextSeq < (u_int32)fnumber )
+				done = 0;
+
+		if( progress )
+			lastProgress = now;
+		else if( !done ){
+			if( now - lastProgress > (u_int32)idleTout ){
+				if( verbose )
+					printf("no progress for %d ms, stop\n", idleTout);
+				done = 1;
+			}
+			else if( evloop ){
+				/* both paths belong to the same device: one wait serves
+				 * Rx of both channels and Tx of the blocked ones */
+				evMask = 0;
+				for( ch=0; ch<CH_NUM; ch++ ){
+					if( path[ch] < 0 )
+						continue;
+					evMask |= M75_EV_CH( ch, M75_EV_RX | M75_EV_ERR );
+					if( bch[ch].active && bch[ch].txFull )
+						evMask |= M75_EV_CH( ch, M75_EV_TX );
+				}
+				n = ( path[0] >= 0 ) ? path[0] : path[1];
+				if( M_setstat( n, M75_EV_MASK, evMask ) ||
+					( M_setstat( n, M75_EV_WAIT, 10 ) &&
+					  UOS_ErrnoGet() != ERR_OSS_TIMEOUT ) ){
+					PrintError("setstat M75_EV_WAIT");
+					error++;
+					done = 1;
+				}
+			}
+			else
+				UOS_Delay( 1 );
+		}
+
+		if( UOS_KeyPressed() != -1 ){
+			aborted = 1;
+			done = 1;
+		}
+	}
+
+	/*--------------------+
+    |  report             |
+    +--------------------*/
+	if( !machine ){
+		printf("\nch   sent   recv   lost  reord    dup  dataerr rx/txerr"
+			   "  frames/s    Mbit/s  wire%%"
+			   "   p50   p99 p99.9   max [ms]\n");
+	}
+
+	for( ch=0; ch<CH_NUM; ch++ ){
+		u_int32 rxGood, lost;
+
+		bc = &bch[ch];
+		if( !bc->active )
+			continue;
+
+		rxGood = bc->rxNum - bc->dup;
+		lost   = bc->txSeq - rxGood;
+		msec   = bc->rxNum ? bc->endTime - bc->startTime : 0;
+		if( msec == 0 )
+			msec = 1;
+
+		fps		 = RateCalc( rxGood, msec, 1000 );
+		kbps	 = RateCalc( bc->rxBytes, msec, 8 );	/* bits/ms = kbit/s */
+
+		qsort( bc->lat, bc->latNum, sizeof(u_int32), LatCmp );
+
+		if( lost || bc->reord || bc->dup || bc->dataErr ||
+			bc->rxErr || bc->txErr )
+			error++;
+
+		if( machine ){
+			printf("m75_bench ch=%d rxch=%d size=%d frames=%d queue=%d "
+				   "window=%d tconst=0x%x bitrate=%d sent=%d recv=%d "
+				   "lost=%d reord=%d dup=%d dataerr=%d rxerr=%d txerr=%d "
+				   "time_ms=%d fps=%d kbps=%d wire_kbps=%d eff_pm=%d "
+				   "lat_p50_ms=%d lat_p99_ms=%d lat_p999_ms=%d "
+				   "lat_max_ms=%d lat_res_ms=%d\n",
+				   ch, bc->rxChan, fsize, fnumber, qdepth, window, tconst,
+				   bitrate, bc->txSeq, rxGood, lost, bc->reord, bc->dup,
+				   bc->dataErr, bc->rxErr, bc->txErr, msec, fps, kbps,
+				   wireKbps, wireKbps ? kbps * 1000 / wireKbps : 0,
+				   LatPerc( bc, 500 ), LatPerc( bc, 990 ),
+				   LatPerc( bc, 999 ), LatPerc( bc, 1000 ),
+				   UOS_MsecTimerResolution());
+		}
+		else {
+			printf("%d>%d %6d %6d %6d %6d %6d %8d %4d/%-4d %9d %5d.%03d %5d"
+				   " %5d %5d %5d %5d\n",
+				   ch, bc->rxChan, bc->txSeq, rxGood, lost, bc->reord,
+				   bc->dup, bc->dataErr, bc->rxErr, bc->txErr, fps,
+				   kbps / 1000, kbps % 1000,
+				   wireKbps ? kbps * 100 / wireKbps : 0,
+				   LatPerc( bc, 500 ), LatPerc( bc, 990 ),
+				   LatPerc( bc, 999 ), LatPerc( bc, 1000 ));
+		}
+	}
+
+	/* driver counters of all channels involved */
+	if( verbose || machine ){
+		for( ch=0; ch<CH_NUM; ch++ )
+			if( path[ch] >= 0 )
+				DrvStatsPrint( path[ch], ch, machine );
+	}
+
+	if( !machine ){
+		printf("\nwire payload rate %d.%03d Mbit/s, "
+			   "latency resolution %d ms\n", wireKbps / 1000,
+			   wireKbps % 1000, UOS_MsecTimerResolution());
+		if( aborted )
+			printf("*** aborted by key press\n");
+		if( !error && !aborted )
+			printf("  ==> OK\n");
+		else
+			printf("\n*** ERROR *** M75_BENCH completed with errors\n");
+	}
+
+	/*--------------------+
+    |  cleanup            |
+    +--------------------*/
+abort:
+	for( ch=0; ch<CH_NUM; ch++ ){
+		if( sigOn && path[ch] >= 0 ){
+			M_setstat( path[ch], M75_CLRRXSIG, 0 );
+			UOS_SigRemove( ch ? UOS_SIG_USR2 : UOS_SIG_USR1 );
+		}
+		if( path[ch] >= 0 && M_close(path[ch]) < 0 )
+			PrintError("close");
+		if( bch[ch].seen )
+			free( bch[ch].seen );
+		if( bch[ch].lat )
+			free( bch[ch].lat );
+	}
+
+	if( sigOn )
+		UOS_SigExit();
+
+	return(0);
+}
+
+/******************************** SigHandler *******************************/
+/** Signal handler for the Rx signals (-g), nothing to do
+ *
+ *  \param sigCode    \IN  signal code received
+ */
+static void SigHandler( u_int32 sigCode )
+{
+	(void)sigCode;
+}
+
+/******************************** ChanConfig *******************************/
+/** Set up a channel for SDLC transfer with the benchmark queue depth
+ *
+ *  \param path       \IN  path, not yet bound to a channel
+ *  \param chan       \IN  channel number
+ *  \param tconst     \IN  BR Gen timeconstant
+ *  \param rfio       \IN  select rear I/O
+ *  \param lloop      \IN  enable local loopback
+ *  \param qdepth     \IN  Rx/Tx queue depth (frames)
+ *
+ *  \return	          success (0) or error (1)
+ */
+static int32 ChanConfig( MDIS_PATH path, int32 chan, int32 tconst, int32 rfio,
+						 int32 lloop, int32 qdepth )
+{
+	if ((M_setstat(path, M_MK_CH_CURRENT, chan)) < 0) {
+		PrintError("setstat M_MK_CH_CURRENT");
+		return(1);
+	}
+
+	M_setstat( path, M75_IO_SEL, rfio );
+	M_setstat( path, M75_BRGEN_TCONST, tconst );
+	M_setstat( path, M75_SCC_REG_10, WR10_DEFAULT );
+	M_setstat( path, M75_SCC_REG_11, WR11_DEFAULT );
+	M_setstat( path, M75_SCC_REG_14, WR14_DEFAULT | (lloop ? 0x10 : 0) );
+
+	/* queues, never block */
+	if( M_setstat(path, M75_MAX_RXFRAME_NUM, qdepth) ||
+		M_setstat(path, M75_MAX_RXFRAME_SIZE, EXT_FIFO_SIZE) ||
+		M_setstat(path, M75_MAX_TXFRAME_NUM, qdepth) ||
+		M_setstat(path, M75_MAX_TXFRAME_SIZE, EXT_FIFO_SIZE) ) {
+		PrintError("setstat queue size");
+		return(1);
+	}
+	M_setstat(path, M75_GETBLOCK_TOUT, 0);
+	M_setstat(path, M75_SETBLOCK_TOUT, 0);
+
+	/* enable IRQs */
+	M_setstat(path, M_MK_IRQ_ENABLE, 0x01);
+	M_setstat(path, M75_IRQ_ENABLE, 0x01);
+
+	/* 8bits/char, Rx CRC En, Rx En */
+	if( M_setstat( path, M75_SCC_REG_03, 0xd9 ) ) {
+		PrintError("setstat M75_SCC_REG_03");
+		return(1);
+	}
+	return(0);
+}
+
+/******************************** FrameBuild *******************************/
+/** Build payload: header and pattern derived from the sequence number
+ *
+ *  The Tx time (bytes 8..11) is filled in by the caller.
+ *
+ *  \param buf        \OUT frame buffer
+ *  \param size       \IN  frame size
+ *  \param chan       \IN  transmitting channel
+ *  \param seq        \IN  sequence number
+ */
+static void FrameBuild( u_int8 *buf, int32 size, int32 chan, u_int32 seq )
+{
+	int32 i;
+
+	buf[0] = HDR_MAGIC0;
+	buf[1] = HDR_MAGIC1;
+	buf[2] = (u_int8)chan;
+	buf[3] = 0;
+	memcpy( &buf[4], &seq, sizeof(seq) );
+	memset( &buf[8], 0, 4 );
+
+	for( i=HDR_SIZE; i<size; i++ )
+		buf[i] = (u_int8)(seq + i);
+}
+
+/******************************** FrameCheck *******************************/
+/** Check received frame and account it to the transmitting channel
+ *
+ *  \param bc         \IN  transmitting channel
+ *  \param chan       \IN  transmitting channel number
+ *  \param buf        \IN  received frame (incl. CRC)
+ *  \param len        \IN  received bytes
+ *  \param size       \IN  frame size
+ *  \param fnumber    \IN  frames sent per channel
+ *
+ *  \return	          frame ok (0) or bad (1)
+ */
+static int32 FrameCheck( BENCH_CHAN *bc, int32 chan, u_int8 *buf,
+						 int32 len, int32 size, int32 fnumber )
+{
+	u_int32 seq, txTime, now = UOS_MsecTimerGet();
+	int32 i;
+
+	if( len != size + CRC_SIZE || buf[0] != HDR_MAGIC0 ||
+		buf[1] != HDR_MAGIC1 || buf[2] != (u_int8)chan ){
+		bc->dataErr++;
+		return(1);
+	}
+
+	memcpy( &seq, &buf[4], sizeof(seq) );
+	memcpy( &txTime, &buf[8], sizeof(txTime) );
+
+	if( seq >= (u_int32)fnumber ){
+		bc->dataErr++;
+		return(1);
+	}
+	for( i=HDR_SIZE; i<size; i++ ){
+		if( buf[i] != (u_int8)(seq + i) ){
+			bc->dataErr++;
+			return(1);
+		}
+	}
+
+	bc->rxNum++;
+	bc->endTime = now;
+
+	if( bc->seen[seq] ){
+		bc->dup++;
+		return(0);
+	}
+	bc->seen[seq] = 1;
+	bc->rxBytes += size;
+	bc->lat[bc->latNum++] = now - txTime;
+
+	if( seq < bc->rxNextSeq )
+		bc->reord++;
+	else
+		bc->rxNextSeq = seq + 1;
+
+	return(0);
+}
+
+/********************************* LatCmp **********************************/
+/** qsort compare function for latencies
+ */
+static int LatCmp( const void *a, const void *b )
+{
+	u_int32 la = *(const u_int32*)a, lb = *(const u_int32*)b;
+
+	return (la > lb) - (la < lb);
+}
+
+/********************************* LatPerc *********************************/
+/** Get latency percentile (nearest rank) from sorted latencies
+ *
+ *  \param bc         \IN  channel
+ *  \param permille   \IN  percentile in 1/1000 (1000: maximum)
+ *
+ *  \return	          latency [ms]
+ */
+static u_int32 LatPerc( BENCH_CHAN *bc, u_int32 permille )
+{
+	u_int32 rank;
+
+	if( bc->latNum == 0 )
+		return 0;
+
+	/* ceil(latNum * permille / 1000) without 32-bit overflow */
+	rank = (bc->latNum / 1000) * permille +
+		   ((bc->latNum % 1000) * permille + 999) / 1000;
+	if( rank < 1 )
+		rank = 1;
+	return bc->lat[rank - 1];
+}
+
+/******************************** RateCalc *********************************/
+/** Calculate num * scale / msec without 32-bit overflow of num * scale
+ *
+ *  \param num        \IN  count
+ *  \param msec       \IN  time [ms], > 0
+ *  \param scale      \IN  factor
+ *
+ *  \return	          rate
+ */
+static u_int32 RateCalc( u_int32 num, u_int32 msec, u_int32 scale )
+{
+	return (num / msec) * scale + (num % msec) * scale / msec;
+}
+
+/****************************** DrvStatsPrint ******************************/
+/** Print driver statistics (M75_BLK_STATS) of a channel
+ *
+ *  Also prints the Tx completions (M75_BLK_TX_DONE) still kept by the
+ *  driver, i.e. of the last frames sent.
+ *
+ *  \param path       \IN  path of channel
+ *  \param chan       \IN  channel number
+ *  \param machine    \IN  machine readable output
+ */
+static void DrvStatsPrint( MDIS_PATH path, int32 chan, int32 machine )
+{
+	M75_STATS stats;
+	M75_TX_DONE done[64];
+	M_SG_BLOCK msg_blk;
+	int32 txId = 0, n, i;
+	u_int32 lat, maxLat = 0;
+
+	msg_blk.size = sizeof(stats);
+	msg_blk.data = (void *)&stats;
+	if( M_getstat(path, M75_BLK_STATS, (int32 *)&msg_blk) < 0 ) {
+		PrintError("getstat M75_BLK_STATS");
+		return;
+	}
+
+	printf( machine ?
+			"m75_bench drvstats ch=%d rx=%d tx=%d crcerr=%d overrun=%d "
+			"statovfl=%d rxqfull=%d toolarge=%d txqfull=%d brkabort=%d "
+			"irqrx=%d irqtx=%d irqext=%d rxpollsw=%d rxirqtime=%d "
+			"rxpolltime=%d irqstorm=%d irqstormrearm=%d rxsig=%d\n" :
+			"driver ch %d: rx %d tx %d crcerr %d overrun %d statovfl %d "
+			"rxqfull %d toolarge %d txqfull %d brkabort %d "
+			"irq rx/tx/ext %d/%d/%d rx poll switches %d "
+			"time irq/poll %d/%d ticks irq storms %d/%d rx signals %d\n",
+			chan, stats.rxFrames, stats.txFrames, stats.rxCrcErr,
+			stats.rxOverrun, stats.rxStatOvfl, stats.rxQFull,
+			stats.rxTooLarge, stats.txQFull, stats.breakAbort,
+			stats.irqRx, stats.irqTx, stats.irqExt, stats.rxPollSwitch,
+			stats.rxIrqTime, stats.rxPollTime, stats.irqStorm,
+			stats.irqStormRearm, stats.rxSig );
+
+	msg_blk.size = sizeof(done);
+	msg_blk.data = (void *)done;
+	if( M_getstat(path, M75_TX_ID, &txId) < 0 ||
+		M_getstat(path, M75_BLK_TX_DONE, (int32 *)&msg_blk) < 0 ) {
+		PrintError("getstat M75_BLK_TX_DONE");
+		return;
+	}
+	n = msg_blk.size / sizeof(M75_TX_DONE);
+	for( i=0; i<n; i++ ) {
+		lat = done[i].tDone - done[i].tQueued;
+		if( lat > maxLat )
+			maxLat = lat;
+	}
+
+	printf( machine ?
+			"m75_bench txdone ch=%d txid=%d num=%d lastid=%d maxlat=%d lost=%d\n" :
+			"driver ch %d: tx id %d, last %d completions up to id %d, "
+			"max queue-to-wire %d ticks, %d not read\n",
+			chan, txId, n, n ? done[n-1].id : 0, maxLat, stats.txDoneLost );
+}
+
+/********************************* PrintError ******************************/
+/** Print MDIS error message
+ *
+ *  \param info       \IN  info string
+*/
+static void PrintError(char *info)
+{
+	printf("*** can't %s: %s\n", info, M_errstring(UOS_ErrnoGet()));
+}
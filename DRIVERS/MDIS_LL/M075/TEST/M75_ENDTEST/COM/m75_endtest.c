@@ -319,7 +319,9 @@ int main(int argc, char *argv[])
 			chan, error);
 	}
 
-	UOS_Delay(100);
+	/* let the last frame leave the wire before closing */
+	if( M_setstat(path, M75_TX_DRAIN, 1000) < 0 )
+		PrintError("setstat M75_TX_DRAIN");
 
 	/*--------------------+
     |  cleanup            |
@@ -0,0 +1,93 @@
+/***********************  I n c l u d e  -  F i l e  ************************/
+/*!
+ *        \file  dbg.h
+ *
+ *  	 \brief  Debug output macros (M75 simulator)
+ *
+ *               Host subset of the MDIS header used by the M75 simulator,
+ *               only what m75_drv.c and the M75 programs need.
+ *
+ *     Switches: -
+ */
+/*
+ *---------------------------------------------------------------------------
+ * Copyright 2004-2019, MEN Mikro Elektronik GmbH
+ ****************************************************************************/
+/*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _DBG_H
+#define _DBG_H
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+typedef struct DBG_HANDLE DBG_HANDLE;
+
+/* debug levels */
+#define DBG_LEV1		0x00000001
+#define DBG_LEV2		0x00000002
+#define DBG_LEV3		0x00000004
+#define DBG_LEV4		0x00000008
+#define DBG_LEV5		0x00000010
+#define DBG_LEV6		0x00000020
+#define DBG_LEVERR		0x00008000
+#define DBG_NORM		0x40000000	/* normal (task) context */
+#define DBG_INTR		0x80000000	/* interrupt context */
+
+extern int32 DBG_Init( char *name, DBG_HANDLE **dbgP );
+extern int32 DBG_Exit( DBG_HANDLE **dbgP );
+extern int32 DBG_Write( DBG_HANDLE *dbg, char *frmt, ... );
+extern int32 DBG_Memdump( DBG_HANDLE *dbg, char *txt, void *buf,
+						  u_int32 len, u_int32 fmt );
+
+#ifdef DBG
+# define DBGCMD(_x_)		_x_
+# define DBGINIT(_x_)		DBG_Init _x_
+# define DBGEXIT(_x_)		DBG_Exit _x_
+# define DBG_LWR(_l_,_x_)	\
+	do { if( (DBG_MYLEVEL & (_l_)) == (_l_) ) DBG_Write _x_; } while(0)
+# define DBG_LDMP(_l_,_x_)	\
+	do { if( (DBG_MYLEVEL & (_l_)) == (_l_) ) DBG_Memdump _x_; } while(0)
+#else
+# define DBGCMD(_x_)
+# define DBGINIT(_x_)
+# define DBGEXIT(_x_)
+# define DBG_LWR(_l_,_x_)
+# define DBG_LDMP(_l_,_x_)
+#endif
+
+#define DBGWRT_1(_x_)	DBG_LWR( DBG_NORM|DBG_LEV1, _x_ )
+#define DBGWRT_2(_x_)	DBG_LWR( DBG_NORM|DBG_LEV2, _x_ )
+#define DBGWRT_3(_x_)	DBG_LWR( DBG_NORM|DBG_LEV3, _x_ )
+#define DBGWRT_4(_x_)	DBG_LWR( DBG_NORM|DBG_LEV4, _x_ )
+#define DBGWRT_ERR(_x_)	DBG_LWR( DBG_NORM|DBG_LEVERR, _x_ )
+#define DBGDMP_4(_x_)	DBG_LDMP( DBG_NORM|DBG_LEV4, _x_ )
+
+#define IDBGWRT_1(_x_)	DBG_LWR( DBG_INTR|DBG_LEV1, _x_ )
+#define IDBGWRT_2(_x_)	DBG_LWR( DBG_INTR|DBG_LEV2, _x_ )
+#define IDBGWRT_3(_x_)	DBG_LWR( DBG_INTR|DBG_LEV3, _x_ )
+#define IDBGWRT_4(_x_)	DBG_LWR( DBG_INTR|DBG_LEV4, _x_ )
+#define IDBGWRT_5(_x_)	DBG_LWR( DBG_INTR|DBG_LEV5, _x_ )
+#define IDBGWRT_6(_x_)	DBG_LWR( DBG_INTR|DBG_LEV6, _x_ )
+#define IDBGWRT_ERR(_x_) DBG_LWR( DBG_INTR|DBG_LEVERR, _x_ )
+#define IDBGDMP_4(_x_)	DBG_LDMP( DBG_INTR|DBG_LEV4, _x_ )
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* _DBG_H */
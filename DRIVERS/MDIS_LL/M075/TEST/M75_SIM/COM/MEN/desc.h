@@ -0,0 +1,53 @@
+/***********************  I n c l u d e  -  F i l e  ************************/
+/*!
+ *        \file  desc.h
+ *
+ *  	 \brief  Descriptor access (M75 simulator)
+ *
+ *               Host subset of the MDIS header used by the M75 simulator,
+ *               only what m75_drv.c and the M75 programs need.
+ *
+ *     Switches: -
+ */
+/*
+ *---------------------------------------------------------------------------
+ * Copyright 2004-2019, MEN Mikro Elektronik GmbH
+ ****************************************************************************/
+/*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _DESC_H
+#define _DESC_H
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+typedef struct DESC_HANDLE	DESC_HANDLE;
+typedef void				DESC_SPEC;
+
+extern char *DESC_Ident( void );
+extern int32 DESC_Init( DESC_SPEC *descSpec, OSS_HANDLE *osHdl,
+						DESC_HANDLE **descHandleP );
+extern int32 DESC_Exit( DESC_HANDLE **descHandleP );
+extern int32 DESC_DbgLevelSet( DESC_HANDLE *descHandle, u_int32 dbgLevel );
+extern int32 DESC_GetUInt32( DESC_HANDLE *descHandle, u_int32 defVal,
+							 u_int32 *valueP, char *keyFmt, ... );
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* _DESC_H */
@@ -0,0 +1,62 @@
+/***********************  I n c l u d e  -  F i l e  ************************/
+/*!
+ *        \file  ll_defs.h
+ *
+ *  	 \brief  Low-level driver definitions (M75 simulator)
+ *
+ *               Host subset of the MDIS header used by the M75 simulator,
+ *               only what m75_drv.c and the M75 programs need.
+ *
+ *     Switches: -
+ */
+/*
+ *---------------------------------------------------------------------------
+ * Copyright 2004-2019, MEN Mikro Elektronik GmbH
+ ****************************************************************************/
+/*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _LL_DEFS_H
+#define _LL_DEFS_H
+
+/* ident function table */
+#define MAX_ID_FUNCT	8
+
+typedef struct {
+	char *(*identCall)( void );
+} MDIS_IDENT_FUNCT;
+
+typedef struct {
+	MDIS_IDENT_FUNCT idCall[MAX_ID_FUNCT];
+} MDIS_IDENT_FUNCT_TBL;
+
+/* Irq() return values */
+#define LL_IRQ_DEVICE		0	/* irq caused by device */
+#define LL_IRQ_DEV_NOT		1	/* irq not caused by device */
+#define LL_IRQ_UNKNOWN		2	/* unknown */
+
+/* Info() codes */
+#define LL_INFO_HW_CHARACTER	1
+#define LL_INFO_ADDRSPACE_COUNT	2
+#define LL_INFO_ADDRSPACE		3
+#define LL_INFO_IRQ				4
+#define LL_INFO_LOCKMODE		5
+
+/* lock modes */
+#define LL_LOCK_NONE		0
+#define LL_LOCK_CALL		1
+#define LL_LOCK_CHAN		2
+
+#endif /* _LL_DEFS_H */
@@ -0,0 +1,60 @@
+/***********************  I n c l u d e  -  F i l e  ************************/
+/*!
+ *        \file  ll_entry.h
+ *
+ *  	 \brief  Low-level driver jump table (M75 simulator)
+ *
+ *               Host subset of the MDIS header used by the M75 simulator,
+ *               only what m75_drv.c and the M75 programs need.
+ *
+ *     Switches: -
+ */
+/*
+ *---------------------------------------------------------------------------
+ * Copyright 2004-2019, MEN Mikro Elektronik GmbH
+ ****************************************************************************/
+/*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _LL_ENTRY_H
+#define _LL_ENTRY_H
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+#ifndef _LL_DRV_
+	typedef void LL_HANDLE;
+#endif
+
+typedef struct {
+	int32 (*init)( DESC_SPEC*, OSS_HANDLE*, MACCESS*, OSS_SEM_HANDLE*,
+				   OSS_IRQ_HANDLE*, LL_HANDLE** );
+	int32 (*exit)( LL_HANDLE** );
+	int32 (*read)( LL_HANDLE*, int32, int32* );
+	int32 (*write)( LL_HANDLE*, int32, int32 );
+	int32 (*blockRead)( LL_HANDLE*, int32, void*, int32, int32* );
+	int32 (*blockWrite)( LL_HANDLE*, int32, void*, int32, int32* );
+	int32 (*setStat)( LL_HANDLE*, int32, int32, INT32_OR_64 );
+	int32 (*getStat)( LL_HANDLE*, int32, int32, INT32_OR_64* );
+	int32 (*irq)( LL_HANDLE* );
+	int32 (*info)( int32, ... );
+} LL_ENTRY;
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* _LL_ENTRY_H */
@@ -0,0 +1,62 @@
+/***********************  I n c l u d e  -  F i l e  ************************/
+/*!
+ *        \file  maccess.h
+ *
+ *  	 \brief  Hardware access macros (M75 simulator)
+ *
+ *               Host subset of the MDIS header used by the M75 simulator,
+ *               only what m75_drv.c and the M75 programs need.
+ *
+ *     Switches: -
+ */
+/*
+ *---------------------------------------------------------------------------
+ * Copyright 2004-2019, MEN Mikro Elektronik GmbH
+ ****************************************************************************/
+/*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _MACCESS_H
+#define _MACCESS_H
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+/*
+ * The address space is not memory, every access is a call
+ * into the register model of the simulated module.
+ */
+typedef U_INT32_OR_64 MACCESS;
+
+extern u_int8 SIM_Read8( MACCESS ma, u_int32 offs );
+extern void SIM_Write8( MACCESS ma, u_int32 offs, u_int8 val );
+extern void SIM_FifoRead8( MACCESS ma, u_int32 offs, u_int32 n, u_int8 *buf );
+extern void SIM_FifoWrite8( MACCESS ma, u_int32 offs, u_int32 n,
+							const u_int8 *buf );
+
+#define MREAD_D8(ma,offs)		SIM_Read8( (MACCESS)(ma), (offs) )
+#define MWRITE_D8(ma,offs,val)	SIM_Write8( (MACCESS)(ma), (offs), (u_int8)(val) )
+
+#define MFIFO_READ_D8(ma,offs,n,buf)	\
+	SIM_FifoRead8( (MACCESS)(ma), (offs), (u_int32)(n), (u_int8*)(buf) )
+#define MFIFO_WRITE_D8(ma,offs,n,buf)	\
+	SIM_FifoWrite8( (MACCESS)(ma), (offs), (u_int32)(n), (u_int8*)(buf) )
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* _MACCESS_H */
@@ -0,0 +1,56 @@
+/***********************  I n c l u d e  -  F i l e  ************************/
+/*!
+ *        \file  mdis_api.h
+ *
+ *  	 \brief  MDIS user API (M75 simulator)
+ *
+ *               Host subset of the MDIS header used by the M75 simulator,
+ *               only what m75_drv.c and the M75 programs need.
+ *
+ *     Switches: -
+ */
+/*
+ *---------------------------------------------------------------------------
+ * Copyright 2004-2019, MEN Mikro Elektronik GmbH
+ ****************************************************************************/
+/*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _MDIS_API_H
+#define _MDIS_API_H
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+#include <MEN/mdis_com.h>
+
+typedef INT32_OR_64 MDIS_PATH;
+
+extern MDIS_PATH M_open( const char *device );
+extern int32 M_close( MDIS_PATH path );
+extern int32 M_getstat( MDIS_PATH path, int32 code, int32 *dataP );
+extern int32 M_setstat( MDIS_PATH path, int32 code, INT32_OR_64 data );
+extern int32 M_read( MDIS_PATH path, int32 *valueP );
+extern int32 M_write( MDIS_PATH path, int32 value );
+extern int32 M_getblock( MDIS_PATH path, u_int8 *buffer, int32 length );
+extern int32 M_setblock( MDIS_PATH path, const u_int8 *buffer, int32 length );
+extern char *M_errstring( int32 errCode );
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* _MDIS_API_H */
@@ -0,0 +1,79 @@
+/***********************  I n c l u d e  -  F i l e  ************************/
+/*!
+ *        \file  mdis_com.h
+ *
+ *  	 \brief  MDIS common status codes (M75 simulator)
+ *
+ *               Host subset of the MDIS header used by the M75 simulator,
+ *               only what m75_drv.c and the M75 programs need.
+ *
+ *     Switches: -
+ */
+/*
+ *---------------------------------------------------------------------------
+ * Copyright 2004-2019, MEN Mikro Elektronik GmbH
+ ****************************************************************************/
+/*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _MDIS_COM_H
+#define _MDIS_COM_H
+
+#define __MAPILIB		/* calling convention of callbacks */
+
+/** block getstat/setstat buffer */
+typedef struct {
+	int32	size;		/* data buffer size */
+	void	*data;		/* data buffer */
+} M_SG_BLOCK;
+typedef M_SG_BLOCK M_SETGETSTAT_BLOCK;
+
+/* status code offsets */
+#define M_MK_OF			0x0000	/* MDIS kernel */
+#define M_LL_OF			0x0100	/* low-level driver */
+#define M_DEV_OF		0x0200	/* device specific */
+#define M_MK_BLK_OF		0x8000	/* MDIS kernel, block */
+#define M_LL_BLK_OF		0x8100	/* low-level driver, block */
+#define M_DEV_BLK_OF	0x8200	/* device specific, block */
+
+#define M_MK_IRQ_ENABLE		(M_MK_OF+0x03)
+#define M_MK_CH_CURRENT		(M_MK_OF+0x04)
+#define M_MK_IRQ_COUNT		(M_MK_OF+0x05)
+
+#define M_LL_DEBUG_LEVEL	(M_LL_OF+0x01)
+#define M_LL_CH_NUMBER		(M_LL_OF+0x02)
+#define M_LL_CH_DIR			(M_LL_OF+0x03)
+#define M_LL_CH_LEN			(M_LL_OF+0x04)
+#define M_LL_CH_TYP			(M_LL_OF+0x05)
+#define M_LL_IRQ_COUNT		(M_LL_OF+0x06)
+#define M_LL_ID_CHECK		(M_LL_OF+0x07)
+#define M_LL_ID_SIZE		(M_LL_OF+0x08)
+
+#define M_MK_BLK_REV_ID		(M_MK_BLK_OF+0x01)
+#define M_LL_BLK_ID_DATA	(M_LL_BLK_OF+0x01)
+
+/* channel direction/type */
+#define M_CH_IN			0
+#define M_CH_OUT		1
+#define M_CH_INOUT		2
+#define M_CH_BINARY		0
+#define M_CH_ANALOG		1
+
+/* access/data width */
+#define MDIS_MA08		0x01
+#define MDIS_MD08		0x01
+#define MDIS_MD16		0x02
+
+#endif /* _MDIS_COM_H */
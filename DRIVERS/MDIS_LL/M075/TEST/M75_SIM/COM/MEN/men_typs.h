@@ -0,0 +1,64 @@
+/***********************  I n c l u d e  -  F i l e  ************************/
+/*!
+ *        \file  men_typs.h
+ *
+ *  	 \brief  MEN basic types (M75 simulator)
+ *
+ *               Host subset of the MDIS header used by the M75 simulator,
+ *               only what m75_drv.c and the M75 programs need.
+ *
+ *     Switches: -
+ */
+/*
+ *---------------------------------------------------------------------------
+ * Copyright 2004-2019, MEN Mikro Elektronik GmbH
+ ****************************************************************************/
+/*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _MEN_TYPS_H
+#define _MEN_TYPS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+
+typedef int8_t		int8;
+typedef uint8_t		u_int8;
+typedef int16_t		int16;
+typedef uint16_t	u_int16;
+typedef int32_t		int32;
+typedef uint32_t	u_int32;
+typedef int64_t		int64;
+typedef uint64_t	u_int64;
+
+#define INT32_OR_64		long			/* pointer sized integer */
+#define U_INT32_OR_64	unsigned long
+
+#ifndef TRUE
+# define TRUE	1
+# define FALSE	0
+#endif
+
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+# define _BIG_ENDIAN_
+#else
+# define _LITTLE_ENDIAN_
+#endif
+
+#define MENT_XSTR(x)	MENT_STR(x)
+#define MENT_STR(x)		#x
+
+#endif /* _MEN_TYPS_H */
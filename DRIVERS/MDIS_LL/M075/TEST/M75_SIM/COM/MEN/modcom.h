@@ -0,0 +1,44 @@
+/***********************  I n c l u d e  -  F i l e  ************************/
+/*!
+ *        \file  modcom.h
+ *
+ *  	 \brief  Module ID PROM access (M75 simulator)
+ *
+ *               Host subset of the MDIS header used by the M75 simulator,
+ *               only what m75_drv.c and the M75 programs need.
+ *
+ *     Switches: -
+ */
+/*
+ *---------------------------------------------------------------------------
+ * Copyright 2004-2019, MEN Mikro Elektronik GmbH
+ ****************************************************************************/
+/*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _MODCOM_H
+#define _MODCOM_H
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+extern int m_read( U_INT32_OR_64 addr, u_int8 index );
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* _MODCOM_H */
@@ -0,0 +1,96 @@
+/***********************  I n c l u d e  -  F i l e  ************************/
+/*!
+ *        \file  oss.h
+ *
+ *  	 \brief  Operating system services (M75 simulator)
+ *
+ *               Host subset of the MDIS header used by the M75 simulator,
+ *               only what m75_drv.c and the M75 programs need.
+ *
+ *     Switches: -
+ */
+/*
+ *---------------------------------------------------------------------------
+ * Copyright 2004-2019, MEN Mikro Elektronik GmbH
+ ****************************************************************************/
+/*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _OSS_H
+#define _OSS_H
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+typedef struct OSS_HANDLE		OSS_HANDLE;
+typedef struct OSS_IRQ_HANDLE	OSS_IRQ_HANDLE;
+typedef struct OSS_SEM_HANDLE	OSS_SEM_HANDLE;
+typedef struct OSS_SIG_HANDLE	OSS_SIG_HANDLE;
+typedef struct OSS_ALARM_HANDLE	OSS_ALARM_HANDLE;
+typedef u_int32					OSS_IRQ_STATE;
+
+#define OSS_SEM_BIN				0
+#define OSS_SEM_COUNT			1
+#define OSS_SEM_WAITFOREVER		-1
+
+#define OSS_DBG_DEFAULT			0xc0008000
+
+extern char *OSS_Ident( void );
+
+/* memory */
+extern void *OSS_MemGet( OSS_HANDLE *osHdl, u_int32 size, u_int32 *gotsizeP );
+extern int32 OSS_MemFree( OSS_HANDLE *osHdl, void *addr, u_int32 size );
+extern void OSS_MemFill( OSS_HANDLE *osHdl, u_int32 size, char *adr, int8 value );
+extern void OSS_MemCopy( OSS_HANDLE *osHdl, u_int32 size, char *src, char *dest );
+
+/* semaphores */
+extern int32 OSS_SemCreate( OSS_HANDLE *osHdl, int32 semType, int32 initVal,
+							OSS_SEM_HANDLE **semP );
+extern int32 OSS_SemRemove( OSS_HANDLE *osHdl, OSS_SEM_HANDLE **semHandleP );
+extern int32 OSS_SemWait( OSS_HANDLE *osHdl, OSS_SEM_HANDLE *semHandle,
+						  int32 msec );
+extern int32 OSS_SemSignal( OSS_HANDLE *osHdl, OSS_SEM_HANDLE *semHandle );
+
+/* signals */
+extern int32 OSS_SigCreate( OSS_HANDLE *osHdl, int32 signal,
+							OSS_SIG_HANDLE **sigHandleP );
+extern int32 OSS_SigRemove( OSS_HANDLE *osHdl, OSS_SIG_HANDLE **sigHandleP );
+extern int32 OSS_SigSend( OSS_HANDLE *osHdl, OSS_SIG_HANDLE *sigHandle );
+
+/* interrupts */
+extern OSS_IRQ_STATE OSS_IrqMaskR( OSS_HANDLE *osHdl, OSS_IRQ_HANDLE *irqHdl );
+extern void OSS_IrqRestore( OSS_HANDLE *osHdl, OSS_IRQ_HANDLE *irqHdl,
+							OSS_IRQ_STATE oldState );
+
+/* timing */
+extern void OSS_MikroDelay( OSS_HANDLE *osHdl, u_int32 usec );
+extern int32 OSS_Delay( OSS_HANDLE *osHdl, int32 msec );
+extern u_int32 OSS_TickGet( OSS_HANDLE *osHdl );
+extern int32 OSS_TickRateGet( OSS_HANDLE *osHdl );
+
+/* alarms */
+extern int32 OSS_AlarmCreate( OSS_HANDLE *osHdl, void (*funct)(void *arg),
+							  void *arg, OSS_ALARM_HANDLE **alarmP );
+extern int32 OSS_AlarmRemove( OSS_HANDLE *osHdl, OSS_ALARM_HANDLE **alarmP );
+extern int32 OSS_AlarmSet( OSS_HANDLE *osHdl, OSS_ALARM_HANDLE *alarm,
+						   u_int32 msec, u_int32 cyclic, u_int32 *realMsecP );
+extern int32 OSS_AlarmClear( OSS_HANDLE *osHdl, OSS_ALARM_HANDLE *alarm );
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* _OSS_H */
@@ -0,0 +1,57 @@
+/***********************  I n c l u d e  -  F i l e  ************************/
+/*!
+ *        \file  usr_oss.h
+ *
+ *  	 \brief  User mode OS services (M75 simulator)
+ *
+ *               Host subset of the MDIS header used by the M75 simulator,
+ *               only what m75_drv.c and the M75 programs need.
+ *
+ *     Switches: -
+ */
+/*
+ *---------------------------------------------------------------------------
+ * Copyright 2004-2019, MEN Mikro Elektronik GmbH
+ ****************************************************************************/
+/*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _USR_OSS_H
+#define _USR_OSS_H
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+#define UOS_SIG_USR1	10
+#define UOS_SIG_USR2	12
+
+extern char *UOS_Ident( void );
+extern u_int32 UOS_ErrnoGet( void );
+extern u_int32 UOS_ErrnoSet( u_int32 errCode );
+extern int32 UOS_Delay( u_int32 msec );
+extern u_int32 UOS_MsecTimerGet( void );
+extern u_int32 UOS_MsecTimerResolution( void );
+extern int32 UOS_KeyPressed( void );
+extern int32 UOS_SigInit( void (*sigHandler)(u_int32 sigCode) );
+extern int32 UOS_SigExit( void );
+extern int32 UOS_SigInstall( u_int32 sigCode );
+extern int32 UOS_SigRemove( u_int32 sigCode );
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* _USR_OSS_H */
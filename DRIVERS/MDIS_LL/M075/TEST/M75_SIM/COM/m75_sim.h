@@ -0,0 +1,73 @@
+/***********************  I n c l u d e  -  F i l e  ************************/
+/*!
+ *        \file  m75_sim.h
+ *
+ *  	 \brief  Internal header file for the M75 host simulator
+ *
+ *               Interface between the register model (m75_sim_hw.c),
+ *               the host OSS/DESC layer (m75_sim_oss.c) and the host
+ *               MDIS/UOS layer (m75_sim_mdis.c).
+ *
+ *     Switches: -
+ */
+/*
+ *---------------------------------------------------------------------------
+ * Copyright 2004-2019, MEN Mikro Elektronik GmbH
+ ****************************************************************************/
+/*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _M75_SIM_H
+#define _M75_SIM_H
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+/*-----------------------------------------+
+|  DEFINES                                 |
++-----------------------------------------*/
+#define SIM_CH_NUM			2			/**< SCC channels */
+#define SIM_PCLK			14745600	/**< SCC clock [Hz] */
+#define SIM_FIFO_SIZE		0x800		/**< external Rx/Tx FIFO size */
+#define SIM_STATFIFO_SIZE	10			/**< SDLC status FIFO entries */
+#define SIM_ASYFIFO_SIZE	8			/**< Z85230 Rx data FIFO depth */
+
+#define SIM_ENV_PREFIX		"M75SIM_"	/**< prefix of environment keys */
+
+/*-----------------------------------------+
+|  PROTOTYPES                              |
++-----------------------------------------*/
+/* m75_sim_hw.c: register model and wire engine */
+extern int32 SIM_HwInit( void );
+extern void SIM_HwExit( void );
+extern void SIM_IrqConnect( int32 (*isr)(void *arg), void *arg );
+extern void SIM_IrqEnable( int32 enable );
+extern u_int16 SIM_IdPromRead( u_int8 index );
+
+/* m75_sim_oss.c: host OSS/DESC services */
+extern u_int64 SIM_TimeNs( void );
+extern char *SIM_EnvKey( const char *key );
+extern void SIM_IrqContext( int32 inIsr );
+
+/* m75_sim_mdis.c: user signals */
+extern void SIM_SigRaise( int32 sigCode );
+extern int32 SIM_SigCount( void );		/* signals raised so far */
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* _M75_SIM_H */
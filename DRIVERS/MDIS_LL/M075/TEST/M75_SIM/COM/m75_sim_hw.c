@@ -0,0 +1,1236 @@
+/*********************  P r o g r a m  -  M o d u l e ***********************/
+/*!
+ *        \file  m75_sim_hw.c
+ *
+ *      \brief   Register model of the M75 module for the host simulator
+ *
+ *               Models what m75_drv.c touches on the module:
+ *               - Z85230 ESCC register pointer scheme, WR00..WR15, WR7',
+ *                 RR00..RR15 incl. extended read (WR7' D6)
+ *               - SDLC status FIFO (RR06/RR07, popped by reading RR01)
+ *               - external Rx/Tx FIFOs, FIFO status and reset registers,
+ *                 channel mode registers
+ *               - Ext/Status, Tx and Rx interrupt pending bits, RR02/RR03;
+ *                 RR00 is frozen while the Ext/Status IP is pending
+ *               - ID PROM contents
+ *
+ *               A wire engine thread clocks bytes out of the transmitters
+ *               at the rate given by the BR generator (WR12/WR13,
+ *               14.7456 MHz clock) and raises the interrupt line.
+ *               The Tx line of a channel is connected to the Rx line of the
+ *               same channel (M75SIM_WIRE=loop, default) or of the other
+ *               channel (M75SIM_WIRE=cross). SCC local loopback (WR14 D4)
+ *               always connects a channel to itself.
+ *
+ *     Required: -
+ *     \switches (none)
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2004-2019, MEN Mikro Elektronik GmbH
+ ****************************************************************************/
+/*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <MEN/men_typs.h>
+#include <MEN/oss.h>
+#include <MEN/maccess.h>
+#include <MEN/mdis_err.h>
+#include "m75_sim.h"
+
+/*--------------------------------------+
+|   DEFINES                             |
++--------------------------------------*/
+/* register index, address offset >> 1 (independent of byte lane) */
+#define IDX_DATA_A		0
+#define IDX_DATA_B		1
+#define IDX_COMM_A		2
+#define IDX_COMM_B		3
+#define IDX_FIFO_A		4
+#define IDX_FIFO_B		5
+#define IDX_FSTAT_A		6
+#define IDX_FSTAT_B		7
+#define IDX_FRESET		8
+#define IDX_CHM_A		9
+#define IDX_CHM_B		10
+
+/* FIFO status register */
+#define FSTAT_TXEMPTY	0x10
+#define FSTAT_TXEN		0x80
+
+/* SCC register bits used by the model */
+#define WR01_EXT_IE		0x01
+#define WR01_TX_IE		0x02
+#define WR01_RX_MASK	0x18
+#define WR01_RX_FIRST	0x08
+#define WR01_RX_ALL		0x10
+#define WR01_RX_SPEC	0x18
+#define WR03_RX_EN		0x01
+#define WR03_RX_CRC_EN	0x08
+#define WR04_STOP_MASK	0x0C
+#define WR05_TX_CRC_EN	0x01
+#define WR05_TX_EN		0x08
+#define WR7P_EXT_READ	0x40
+#define WR09_MIE		0x08
+#define WR09_VIS		0x01
+#define WR09_SHSL		0x10
+#define WR14_BRG_EN		0x01
+#define WR14_LOOPBACK	0x10
+#define WR15_WR7P_EN	0x01
+#define WR15_FIFO_EN	0x04
+#define WR15_EOM_IE		0x40
+#define WR15_ABORT_IE	0x80
+
+#define RR00_RX_AVAIL	0x01
+#define RR00_TX_EMPTY	0x04
+#define RR00_DCD		0x08
+#define RR00_SYNC_HUNT	0x10
+#define RR00_CTS		0x20
+#define RR00_EOM		0x40
+#define RR00_ABORT		0x80
+#define RR01_ALL_SENT	0x01
+#define RR01_RESIDUE8	0x06
+#define RR01_PARITY		0x10
+#define RR01_OVERRUN	0x20
+#define RR01_CRC_FRM	0x40
+#define RR01_EOF		0x80
+#define RR01_ERRORS		(RR01_PARITY|RR01_OVERRUN|RR01_CRC_FRM)
+#define RR07_FDA		0x40
+#define RR07_FOS		0x80
+
+#define CRC_GOOD		0xF0B8	/* CRC-CCITT residue over data and FCS */
+
+#define NS_PER_SEC		1000000000ULL
+#define IDLE_WAIT_NS	50000000ULL	/* engine wait without events */
+#define STORM_CALLS		1000		/* ISR calls before time is advanced */
+
+/* transmitter slot in SDLC mode */
+#define SLOT_NONE		0
+#define SLOT_FLAG		1	/* opening flag */
+#define SLOT_DATA		2
+#define SLOT_CRC		3
+#define SLOT_CLOSE		4	/* closing flag */
+
+#define FIFO_CNT(f)		((f)->put - (f)->get)
+#define MAX_NS(a,b)		((a) > (b) ? (a) : (b))
+
+/*--------------------------------------+
+|   TYPDEFS                             |
++--------------------------------------*/
+/** external FIFO */
+typedef struct {
+	u_int8	buf[SIM_FIFO_SIZE];
+	u_int32	get;				/**< free running read count */
+	u_int32	put;				/**< free running write count */
+} SIM_FIFO;
+
+/** SDLC status FIFO entry */
+typedef struct {
+	u_int8	rr1;
+	u_int16	bc;					/**< byte count incl. CRC */
+} SIM_STAT;
+
+/** one SCC channel with its external FIFOs */
+typedef struct {
+	/* registers */
+	u_int8		wr[16];			/**< WR02/WR09 are shared, see SIM_M75 */
+	u_int8		wr7p;
+	u_int8		ptr;			/**< register pointer */
+	u_int8		chm;			/**< channel mode register */
+	u_int8		fifoCtl;		/**< FIFO status register (TXEN) */
+
+	/* status and interrupts */
+	u_int8		rr0;			/**< EOM, Break/Abort */
+	u_int8		rr0Frz;			/**< rr0 frozen while extIP is set */
+	u_int8		extIP;			/**< Ext/Status IP latched */
+	u_int8		txIP;			/**< Tx IP latched */
+	u_int8		nxtRxArm;		/**< Rx int on next char armed */
+
+	/* external FIFOs */
+	SIM_FIFO	txFifo;
+	SIM_FIFO	rxFifo;
+
+	/* SDLC status FIFO */
+	SIM_STAT	stat[SIM_STATFIFO_SIZE];
+	u_int32		statGet;
+	u_int32		statPut;
+	u_int8		fos;			/**< status FIFO overflowed */
+	SIM_STAT	lastStat;		/**< status of last frame, FIFO off */
+
+	/* async Rx data FIFO */
+	u_int8		asyData[SIM_ASYFIFO_SIZE];
+	u_int8		asyRr1[SIM_ASYFIFO_SIZE];
+	u_int32		asyGet;
+	u_int8		asyErrLatch;	/**< overrun/parity of chars read, until Error Reset */
+	u_int32		asyPut;
+
+	/* transmitter */
+	u_int8		slot;			/**< SDLC slot currently on the wire */
+	u_int8		slotByte;
+	u_int8		inCrc;			/**< FIFO underrun, sending CRC */
+	u_int8		crcBuf[2];
+	u_int8		crcIdx;
+	u_int16		txCrc;
+	u_int8		txBuf;			/**< async Tx buffer */
+	u_int8		txBufFull;
+	u_int8		txShift;		/**< async Tx shift register */
+	u_int8		txShiftBusy;
+	u_int64		txNext;			/**< end of current slot/char [ns] */
+	u_int64		txIdle;			/**< line idle since [ns] */
+	u_int64		txLoadAt;		/**< last Tx data load [ns] */
+	u_int32		txFrames;
+
+	/* receiver */
+	u_int8		rxInFrame;
+	u_int8		rxOvr;
+	u_int16		rxCrc;
+	u_int32		rxCnt;
+} SIM_CHAN;
+
+/** the module */
+typedef struct {
+	SIM_CHAN		ch[SIM_CH_NUM];
+	u_int8			wr02;			/**< interrupt vector (shared) */
+	u_int8			wr09;			/**< master interrupt control (shared) */
+	u_int8			loop;			/**< wire: Tx to own Rx */
+	u_int32			crcErrEvery;	/**< corrupt CRC of every n-th frame */
+	u_int64			irqDelayNs;		/**< ISR call after line asserted */
+	u_int32			trace;
+
+	pthread_mutex_t	lock;
+	pthread_cond_t	cond;
+	pthread_t		thread;
+	int32			run;
+
+	int32			(*isr)(void *arg);
+	void			*isrArg;
+	int32			irqEn;
+	int32			inIsr;			/**< ISR running, wire time frozen */
+} SIM_M75;
+
+/*--------------------------------------+
+|   GLOBALS                             |
++--------------------------------------*/
+static SIM_M75 G_m75 = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+};
+
+/*--------------------------------------+
+|   PROTOTYPES                          |
++--------------------------------------*/
+static void ChanReset( SIM_CHAN *c );
+static void Advance( SIM_M75 *m, u_int64 now );
+static void *Engine( void *arg );
+
+/*--------------------------------------+
+|   HELPERS                             |
++--------------------------------------*/
+static u_int16 Crc( u_int16 crc, u_int8 b )
+{
+	int i;
+
+	crc ^= b;
+	for( i=0; i<8; i++ )
+		crc = (crc & 1) ? ((crc >> 1) ^ 0x8408) : (crc >> 1);
+	return crc;
+}
+
+static int IsSync( SIM_CHAN *c )
+{
+	return (c->wr[4] & WR04_STOP_MASK) == 0;
+}
+
+static int Peer( SIM_M75 *m, int ch )
+{
+	if( m->loop || (m->ch[ch].wr[14] & WR14_LOOPBACK) )
+		return ch;
+	return ch ^ 1;
+}
+
+/** BR generator clock period * 2 [ns * PCLK]; 0 if not running */
+static u_int64 BrgTicks( SIM_CHAN *c )
+{
+	if( !(c->wr[14] & WR14_BRG_EN) )
+		return 0;
+	return 2ULL * ((c->wr[12] | (c->wr[13] << 8)) + 2);
+}
+
+/** duration of one SDLC byte [ns] */
+static u_int64 ByteNs( SIM_CHAN *c )
+{
+	return 8 * BrgTicks(c) * NS_PER_SEC / SIM_PCLK;
+}
+
+/** duration of one async character [ns] */
+static u_int64 CharNs( SIM_CHAN *c )
+{
+	static const u_int32 mult[4] = { 1, 16, 32, 64 };
+	/* start + 8 data bits + 1, 1.5 or 2 stop bits, in half bits */
+	u_int32 halfBits = 2 * 9 + ((c->wr[4] & WR04_STOP_MASK) >> 2) + 1;
+
+	return halfBits * mult[c->wr[4] >> 6] * BrgTicks(c) * NS_PER_SEC
+		   / SIM_PCLK / 2;
+}
+
+static void Trace( SIM_M75 *m, const char *fmt, ... )
+{
+	va_list ap;
+
+	if( !m->trace )
+		return;
+	va_start( ap, fmt );
+	fprintf( stderr, "m75sim %10.6f: ", (double)SIM_TimeNs() / NS_PER_SEC );
+	vfprintf( stderr, fmt, ap );
+	va_end( ap );
+}
+
+/*--------------------------------------+
+|   RECEIVER                            |
++--------------------------------------*/
+static void ExtLatch( SIM_CHAN *c, u_int8 ie )
+{
+	if( !(c->wr[15] & ie) )
+		return;
+	/* RR00 status is latched until Reset Ext/Status */
+	if( !c->extIP )
+		c->rr0Frz = c->rr0;
+	c->extIP = 1;
+}
+
+static void RxStart( SIM_M75 *m, int ch )
+{
+	SIM_CHAN *r = &m->ch[ch];
+
+	/* flags on the line end a Break/Abort condition */
+	if( r->rr0 & RR00_ABORT ) {
+		r->rr0 &= ~RR00_ABORT;
+		ExtLatch( r, WR15_ABORT_IE );
+	}
+	r->rxInFrame = IsSync(r) && (r->wr[3] & WR03_RX_EN);
+	r->rxCnt	 = 0;
+	r->rxCrc	 = 0xFFFF;
+	r->rxOvr	 = 0;
+}
+
+static void RxByte( SIM_M75 *m, int ch, u_int8 b )
+{
+	SIM_CHAN *r = &m->ch[ch];
+
+	if( !r->rxInFrame )
+		return;
+	r->rxCrc = Crc( r->rxCrc, b );
+	if( FIFO_CNT(&r->rxFifo) < SIM_FIFO_SIZE ) {
+		r->rxFifo.buf[r->rxFifo.put++ % SIM_FIFO_SIZE] = b;
+		r->rxCnt++;
+	} else {
+		r->rxOvr = 1;
+	}
+}
+
+static void RxEnd( SIM_M75 *m, int ch )
+{
+	SIM_CHAN *r = &m->ch[ch];
+	SIM_STAT st;
+
+	if( !r->rxInFrame )
+		return;
+	r->rxInFrame = 0;
+
+	st.rr1 = RR01_EOF | RR01_RESIDUE8;
+	if( (r->wr[3] & WR03_RX_CRC_EN) && r->rxCrc != CRC_GOOD )
+		st.rr1 |= RR01_CRC_FRM;
+	if( r->rxOvr )
+		st.rr1 |= RR01_OVERRUN;
+	st.bc = (u_int16)(r->rxCnt & 0x3FFF);
+
+	if( !(r->wr[15] & WR15_FIFO_EN) )
+		r->lastStat = st;
+	else if( r->statPut - r->statGet < SIM_STATFIFO_SIZE )
+		r->stat[r->statPut++ % SIM_STATFIFO_SIZE] = st;
+	else
+		r->fos = 1;
+
+	Trace( m, "ch%d Rx frame %u bytes rr1=%02x\n", ch, st.bc, st.rr1 );
+}
+
+static void RxAbort( SIM_M75 *m, int ch )
+{
+	SIM_CHAN *r = &m->ch[ch];
+
+	r->rxInFrame = 0;
+	if( IsSync(r) && (r->wr[3] & WR03_RX_EN) && !(r->rr0 & RR00_ABORT) ) {
+		r->rr0 |= RR00_ABORT;
+		ExtLatch( r, WR15_ABORT_IE );
+	}
+	Trace( m, "ch%d Rx abort\n", ch );
+}
+
+static void AsyRxByte( SIM_M75 *m, int ch, u_int8 b )
+{
+	SIM_CHAN *r = &m->ch[ch];
+
+	if( IsSync(r) || !(r->wr[3] & WR03_RX_EN) )
+		return;
+	if( r->asyPut - r->asyGet < SIM_ASYFIFO_SIZE ) {
+		r->asyData[r->asyPut % SIM_ASYFIFO_SIZE] = b;
+		r->asyRr1[r->asyPut % SIM_ASYFIFO_SIZE]	 = 0;
+		r->asyPut++;
+	} else {
+		/* overrun: last character is overwritten */
+		r->asyData[(r->asyPut-1) % SIM_ASYFIFO_SIZE] = b;
+		r->asyRr1[(r->asyPut-1) % SIM_ASYFIFO_SIZE] |= RR01_OVERRUN;
+	}
+}
+
+/*--------------------------------------+
+|   TRANSMITTER                         |
++--------------------------------------*/
+static void EomSet( SIM_CHAN *c )
+{
+	if( !(c->rr0 & RR00_EOM) ) {
+		c->rr0 |= RR00_EOM;
+		ExtLatch( c, WR15_EOM_IE );
+	}
+}
+
+/** SDLC transmitter: flag, data from external Tx FIFO, CRC, flag */
+static void SyncTx( SIM_M75 *m, int ch, u_int64 now )
+{
+	SIM_CHAN *c = &m->ch[ch];
+	u_int64 bt = ByteNs(c);
+	u_int16 fcs;
+
+	if( !bt )
+		return;		/* no Tx clock */
+
+	for(;;) {
+		if( c->slot == SLOT_NONE ) {
+			/* line idle, start frame when data is enabled */
+			if( !(c->wr[5] & WR05_TX_EN) || !(c->fifoCtl & FSTAT_TXEN) ||
+				!FIFO_CNT(&c->txFifo) )
+				return;
+
+			c->slot   = SLOT_FLAG;
+			c->inCrc  = 0;
+			c->txCrc  = 0xFFFF;
+			c->txNext = MAX_NS( c->txIdle, c->txLoadAt ) + bt;
+			c->rr0	 &= ~RR00_EOM;	/* auto EOM reset (WR7' D1) */
+			RxStart( m, Peer(m, ch) );
+			Trace( m, "ch%d Tx frame start\n", ch );
+		}
+
+		if( c->txNext > now )
+			return;
+
+		if( !(c->wr[5] & WR05_TX_EN) ) {
+			/* transmitter disabled within frame */
+			c->slot	  = SLOT_NONE;
+			c->txIdle = c->txNext;
+			RxAbort( m, Peer(m, ch) );
+			continue;
+		}
+
+		/* slot on the wire completed */
+		switch( c->slot ) {
+		case SLOT_DATA:
+		case SLOT_CRC:
+			RxByte( m, Peer(m, ch), c->slotByte );
+			break;
+		case SLOT_CLOSE:
+			RxEnd( m, Peer(m, ch) );
+			c->slot	  = SLOT_NONE;
+			c->txIdle = c->txNext;
+			c->txFrames++;
+			continue;
+		}
+
+		/* load next slot */
+		if( !c->inCrc &&
+			!((c->fifoCtl & FSTAT_TXEN) && FIFO_CNT(&c->txFifo)) ) {
+			/* underrun: CRC follows, flag Tx Underrun/EOM */
+			fcs = ~c->txCrc;
+			if( m->crcErrEvery && !((c->txFrames + 1) % m->crcErrEvery) )
+				fcs ^= 0x0001;
+			c->crcBuf[0] = (u_int8)fcs;
+			c->crcBuf[1] = (u_int8)(fcs >> 8);
+			c->crcIdx	 = 0;
+			c->inCrc	 = 1;
+			EomSet( c );
+		}
+
+		if( c->inCrc ) {
+			if( c->crcIdx < 2 && (c->wr[5] & WR05_TX_CRC_EN) ) {
+				c->slot		= SLOT_CRC;
+				c->slotByte = c->crcBuf[c->crcIdx++];
+			} else {
+				c->slot = SLOT_CLOSE;
+			}
+		} else {
+			c->slot		= SLOT_DATA;
+			c->slotByte = c->txFifo.buf[c->txFifo.get++ % SIM_FIFO_SIZE];
+			c->txCrc	= Crc( c->txCrc, c->slotByte );
+		}
+		c->txNext += bt;
+	}
+}
+
+/** async transmitter: Tx buffer, fed by DATA or external Tx FIFO (REQ),
+ *  and shift register */
+static void AsyncTx( SIM_M75 *m, int ch, u_int64 now )
+{
+	SIM_CHAN *c = &m->ch[ch];
+	u_int64 ct = CharNs(c);
+
+	if( !ct )
+		return;		/* no Tx clock */
+
+	for(;;) {
+		if( !c->txBufFull && (c->fifoCtl & FSTAT_TXEN) &&
+			FIFO_CNT(&c->txFifo) ) {
+			c->txBuf	 = c->txFifo.buf[c->txFifo.get++ % SIM_FIFO_SIZE];
+			c->txBufFull = 1;
+		}
+
+		if( !c->txShiftBusy ) {
+			if( !(c->wr[5] & WR05_TX_EN) || !c->txBufFull )
+				return;
+			c->txShift	   = c->txBuf;
+			c->txBufFull   = 0;
+			c->txShiftBusy = 1;
+			c->txNext	   = MAX_NS( c->txIdle, c->txLoadAt ) + ct;
+			if( c->wr[1] & WR01_TX_IE )
+				c->txIP = 1;
+		}
+
+		if( c->txNext > now )
+			return;
+
+		AsyRxByte( m, Peer(m, ch), c->txShift );
+		if( m->trace > 1 )
+			Trace( m, "ch%d Tx char %02x\n", ch, c->txShift );
+		c->txShiftBusy = 0;
+		c->txIdle	   = c->txNext;
+
+		/* engine stalled (ISR running, host descheduled): the wire was
+		 * halted meanwhile, do not burst the FIFO into the receiver */
+		if( now > c->txIdle + ct )
+			c->txIdle = now;
+	}
+}
+
+static void TxAbort( SIM_M75 *m, int ch )
+{
+	SIM_CHAN *c = &m->ch[ch];
+
+	if( c->slot != SLOT_NONE ) {
+		c->slot	  = SLOT_NONE;
+		c->txIdle = SIM_TimeNs();
+		RxAbort( m, Peer(m, ch) );
+	}
+}
+
+/*
+ * The wire does not move while the ISR runs: a host thread may be
+ * descheduled for longer than a character time, an ISR on the target
+ * is not. Without this, a character could be shifted out between the
+ * ISR's data write and its Reset Tx Int Pending, losing the Tx IP.
+ */
+static void Advance( SIM_M75 *m, u_int64 now )
+{
+	int ch;
+
+	if( m->inIsr )
+		return;
+
+	for( ch=0; ch<SIM_CH_NUM; ch++ ) {
+		if( IsSync(&m->ch[ch]) )
+			SyncTx( m, ch, now );
+		else
+			AsyncTx( m, ch, now );
+	}
+}
+
+/** earliest time something happens on the wire */
+static u_int64 NextEvent( SIM_M75 *m, u_int64 now )
+{
+	u_int64 next = now + IDLE_WAIT_NS;
+	int ch;
+
+	for( ch=0; ch<SIM_CH_NUM; ch++ ) {
+		SIM_CHAN *c = &m->ch[ch];
+
+		if( (c->slot != SLOT_NONE || c->txShiftBusy) && c->txNext < next )
+			next = c->txNext;
+	}
+	return next;
+}
+
+/*--------------------------------------+
+|   INTERRUPTS                          |
++--------------------------------------*/
+static int RxIP( SIM_CHAN *c )
+{
+	u_int8 mode = c->wr[1] & WR01_RX_MASK;
+
+	if( !mode )
+		return 0;
+	if( IsSync(c) )
+		return c->statPut != c->statGet;	/* end of frame */
+	if( c->asyPut == c->asyGet )
+		return 0;
+	switch( mode ) {
+	case WR01_RX_FIRST:
+		return c->nxtRxArm ||
+			   (c->asyRr1[c->asyGet % SIM_ASYFIFO_SIZE] & RR01_ERRORS);
+	case WR01_RX_ALL:
+		return 1;
+	default:
+		return (c->asyRr1[c->asyGet % SIM_ASYFIFO_SIZE] & RR01_ERRORS) != 0;
+	}
+}
+
+static u_int8 Rr3( SIM_M75 *m )
+{
+	u_int8 ip = 0;
+	int ch;
+
+	for( ch=0; ch<SIM_CH_NUM; ch++ ) {
+		SIM_CHAN *c = &m->ch[ch];
+		u_int8 chIp = 0;
+
+		if( c->extIP && (c->wr[1] & WR01_EXT_IE) )
+			chIp |= 0x01;
+		if( c->txIP && (c->wr[1] & WR01_TX_IE) )
+			chIp |= 0x02;
+		if( RxIP(c) )
+			chIp |= 0x04;
+		ip |= ch ? chIp : (chIp << 3);
+	}
+	return ip;
+}
+
+static int IrqLine( SIM_M75 *m )
+{
+	return (m->wr09 & WR09_MIE) && Rr3(m);
+}
+
+/** status modified interrupt vector (RR02 read via channel B) */
+static u_int8 Rr2B( SIM_M75 *m )
+{
+	u_int8 ip = Rr3(m), code;
+
+	if( ip & 0x20 )		 code = 6;	/* ch A Rx */
+	else if( ip & 0x10 ) code = 4;	/* ch A Tx */
+	else if( ip & 0x08 ) code = 5;	/* ch A Ext/Status */
+	else if( ip & 0x04 ) code = 2;	/* ch B Rx */
+	else if( ip & 0x02 ) code = 0;	/* ch B Tx */
+	else if( ip & 0x01 ) code = 1;	/* ch B Ext/Status */
+	else				 code = 3;	/* no IP */
+
+	if( !(m->wr09 & WR09_VIS) )
+		return m->wr02;
+	if( m->wr09 & WR09_SHSL )	/* status high: bits 4..6, reversed */
+		return (m->wr02 & 0x8F) | (((code & 1) << 6) | ((code & 2) << 4) |
+								   ((code & 4) << 2));
+	return (m->wr02 & 0xF1) | (code << 1);
+}
+
+/*--------------------------------------+
+|   REGISTERS                           |
++--------------------------------------*/
+static u_int8 ReadReg( SIM_M75 *m, int ch, u_int8 reg )
+{
+	SIM_CHAN *c = &m->ch[ch];
+	int ext = c->wr7p & WR7P_EXT_READ;
+	SIM_STAT *st = (c->statPut != c->statGet) ?
+				   &c->stat[c->statGet % SIM_STATFIFO_SIZE] : NULL;
+	u_int8 val;
+
+	switch( reg ) {
+	case 0:
+		val = ((c->extIP ? c->rr0Frz : c->rr0) & (RR00_EOM | RR00_ABORT)) |
+			  RR00_DCD | RR00_CTS;
+		if( c->asyPut != c->asyGet )
+			val |= RR00_RX_AVAIL;
+		if( !c->txBufFull )
+			val |= RR00_TX_EMPTY;
+		if( !(c->wr[3] & WR03_RX_EN) )
+			val |= RR00_SYNC_HUNT;
+		return val;
+	case 1:
+		if( IsSync(c) ) {
+			val = c->slot == SLOT_NONE ? RR01_ALL_SENT : 0;
+			if( st ) {
+				/* reading RR01 advances the status FIFO */
+				val |= st->rr1;
+				c->statGet++;
+			} else {
+				val |= RR01_RESIDUE8;
+			}
+		} else {
+			val = (!c->txBufFull && !c->txShiftBusy) ? RR01_ALL_SENT : 0;
+			val |= c->asyErrLatch;
+			if( c->asyPut != c->asyGet )
+				val |= c->asyRr1[c->asyGet % SIM_ASYFIFO_SIZE];
+		}
+		return val;
+	case 2:
+		return ch ? Rr2B(m) : m->wr02;
+	case 3:
+		return ch ? 0 : Rr3(m);
+	case 4:
+		return ext ? c->wr[4] : ReadReg( m, ch, 0 );
+	case 5:
+		return ext ? c->wr[5] : ReadReg( m, ch, 1 );
+	case 6:
+		return (u_int8)(st ? st->bc : c->lastStat.bc);
+	case 7:
+		val = c->fos ? RR07_FOS : 0;
+		if( st )
+			return val | RR07_FDA | ((st->bc >> 8) & 0x3F);
+		return val | ((c->lastStat.bc >> 8) & 0x3F);
+	case 8:
+		if( c->asyPut == c->asyGet )
+			return 0;
+		c->nxtRxArm = 0;
+		/* overrun and parity error latch when the char is read */
+		c->asyErrLatch |= c->asyRr1[c->asyGet % SIM_ASYFIFO_SIZE] &
+						  (RR01_OVERRUN | RR01_PARITY);
+		return c->asyData[c->asyGet++ % SIM_ASYFIFO_SIZE];
+	case 9:
+		return ext ? c->wr[3] : ReadReg( m, ch, 13 );
+	case 10:
+		return 0;
+	case 11:
+		return ext ? c->wr[10] : ReadReg( m, ch, 15 );
+	case 12:
+	case 13:
+		return c->wr[reg];
+	case 14:
+		return ext ? c->wr7p : ReadReg( m, ch, 10 );
+	default:
+		return c->wr[15] & 0xFA;
+	}
+}
+
+static void Command( SIM_M75 *m, int ch, u_int8 val )
+{
+	SIM_CHAN *c = &m->ch[ch];
+
+	switch( (val >> 3) & 7 ) {
+	case 2:		/* reset Ext/Status interrupts */
+		c->extIP = 0;
+		/* changes while RR00 was frozen interrupt again */
+		if( (c->rr0 & ~c->rr0Frz) & RR00_EOM )
+			ExtLatch( c, WR15_EOM_IE );
+		if( (c->rr0 ^ c->rr0Frz) & RR00_ABORT )
+			ExtLatch( c, WR15_ABORT_IE );
+		break;
+	case 3:		/* send abort */
+		TxAbort( m, ch );
+		break;
+	case 4:		/* enable int on next Rx character */
+		c->nxtRxArm = 1;
+		break;
+	case 5:		/* reset Tx int pending */
+		c->txIP = 0;
+		break;
+	case 6:		/* error reset */
+		c->asyErrLatch = 0;
+		if( c->asyPut != c->asyGet )
+			c->asyRr1[c->asyGet % SIM_ASYFIFO_SIZE] &= ~RR01_ERRORS;
+		break;
+	default:	/* null, reset highest IUS */
+		break;
+	}
+	if( (val & 0xC0) == 0xC0 )	/* reset Tx underrun/EOM latch */
+		c->rr0 &= ~RR00_EOM;
+}
+
+static void WriteReg( SIM_M75 *m, int ch, u_int8 reg, u_int8 val )
+{
+	SIM_CHAN *c = &m->ch[ch];
+	u_int8 old = c->wr[reg];
+
+	switch( reg ) {
+	case 2:
+		m->wr02 = val;
+		return;
+	case 7:
+		if( c->wr[15] & WR15_WR7P_EN )
+			c->wr7p = val;
+		else
+			c->wr[7] = val;
+		return;
+	case 8:
+		c->txBuf	 = val;
+		c->txBufFull = 1;
+		c->txIP		 = 0;
+		c->txLoadAt	 = SIM_TimeNs();
+		return;
+	case 9:
+		switch( val & 0xC0 ) {
+		case 0xC0:
+			ChanReset( &m->ch[0] );
+			ChanReset( &m->ch[1] );
+			m->wr09 = 0;
+			return;
+		case 0x80:
+			ChanReset( &m->ch[0] );
+			break;
+		case 0x40:
+			ChanReset( &m->ch[1] );
+			break;
+		}
+		m->wr09 = val & 0x3F;
+		return;
+	}
+
+	c->wr[reg] = val;
+
+	switch( reg ) {
+	case 3:
+		if( (old & WR03_RX_EN) && !(val & WR03_RX_EN) )
+			c->rxInFrame = 0;		/* receiver disabled */
+		break;
+	case 5:
+		if( !(old & WR05_TX_EN) && (val & WR05_TX_EN) )
+			c->txIdle = MAX_NS( c->txIdle, SIM_TimeNs() );
+		break;
+	case 15:
+		if( (old & WR15_FIFO_EN) && !(val & WR15_FIFO_EN) ) {
+			/* disabling the status FIFO resets it */
+			c->statGet = c->statPut;
+			c->fos = 0;
+		}
+		break;
+	}
+}
+
+/** SCC channel reset (WR09 D7/D6) */
+static void ChanReset( SIM_CHAN *c )
+{
+	c->ptr		= 0;
+	c->wr[1]   &= 0x24;
+	c->wr[3]   &= ~WR03_RX_EN;
+	c->wr[4]   |= 0x04;
+	c->wr[5]   &= 0x61;
+	c->wr[10]  &= 0x60;
+	c->wr[14]  &= 0xC0;
+	c->wr[14]  |= 0x20;
+	c->wr[15]	= 0xF8;
+	c->wr7p		= 0x20;
+
+	c->rr0		= RR00_EOM;
+	c->extIP	= 0;
+	c->txIP		= 0;
+	c->nxtRxArm = 1;
+
+	c->statGet	= c->statPut;
+	c->fos		= 0;
+	c->asyGet	= c->asyPut;
+	c->asyErrLatch = 0;
+
+	c->slot		   = SLOT_NONE;
+	c->txBufFull   = 0;
+	c->txShiftBusy = 0;
+	c->rxInFrame   = 0;
+}
+
+/*--------------------------------------+
+|   ADDRESS SPACE                       |
++--------------------------------------*/
+/** access module address space, called with the model locked */
+static u_int8 Read8( SIM_M75 *m, u_int32 offs )
+{
+	u_int32 idx = offs >> 1;
+	int ch = idx & 1;
+	u_int8 val = 0, reg;
+	SIM_CHAN *c;
+
+	switch( idx ) {
+	case IDX_DATA_A:
+	case IDX_DATA_B:
+		val = ReadReg( m, ch, 8 );
+		break;
+	case IDX_COMM_A:
+	case IDX_COMM_B:
+		c = &m->ch[ch];
+		reg = c->ptr;
+		c->ptr = 0;
+		val = ReadReg( m, ch, reg );
+		break;
+	case IDX_FIFO_A:
+	case IDX_FIFO_B:
+		c = &m->ch[ch];
+		if( FIFO_CNT(&c->rxFifo) )
+			val = c->rxFifo.buf[c->rxFifo.get++ % SIM_FIFO_SIZE];
+		break;
+	case IDX_FSTAT_A:
+	case IDX_FSTAT_B:
+		c = &m->ch[ch];
+		val = c->fifoCtl & FSTAT_TXEN;
+		if( !FIFO_CNT(&c->txFifo) )
+			val |= FSTAT_TXEMPTY;
+		break;
+	case IDX_CHM_A:
+		val = m->ch[0].chm;
+		break;
+	case IDX_CHM_B:
+		val = m->ch[1].chm;
+		break;
+	}
+
+	return val;
+}
+
+static void Write8( SIM_M75 *m, u_int32 offs, u_int8 val )
+{
+	u_int32 idx = offs >> 1;
+	int ch = idx & 1, i;
+	u_int8 reg;
+	SIM_CHAN *c;
+
+	switch( idx ) {
+	case IDX_DATA_A:
+	case IDX_DATA_B:
+		WriteReg( m, ch, 8, val );
+		break;
+	case IDX_COMM_A:
+	case IDX_COMM_B:
+		c = &m->ch[ch];
+		if( c->ptr ) {
+			WriteReg( m, ch, c->ptr, val );
+			c->ptr = 0;
+		} else {
+			/* WR00: pointer bits and commands */
+			reg = val & 0x07;
+			if( ((val >> 3) & 7) == 1 )	/* point high */
+				reg |= 0x08;
+			Command( m, ch, val );
+			c->ptr = reg;
+		}
+		break;
+	case IDX_FIFO_A:
+	case IDX_FIFO_B:
+		c = &m->ch[ch];
+		if( !FIFO_CNT(&c->txFifo) )
+			c->txLoadAt = SIM_TimeNs();
+		if( FIFO_CNT(&c->txFifo) < SIM_FIFO_SIZE )
+			c->txFifo.buf[c->txFifo.put++ % SIM_FIFO_SIZE] = val;
+		break;
+	case IDX_FSTAT_A:
+	case IDX_FSTAT_B:
+		c = &m->ch[ch];
+		if( !(c->fifoCtl & FSTAT_TXEN) && (val & FSTAT_TXEN) )
+			c->txLoadAt = SIM_TimeNs();
+		c->fifoCtl = val & FSTAT_TXEN;
+		break;
+	case IDX_FRESET:
+		for( i=0; i<SIM_CH_NUM; i++ ) {
+			c = &m->ch[i];
+			if( (val >> (i*4)) & 0x01 )
+				c->txFifo.get = c->txFifo.put;
+			if( (val >> (i*4)) & 0x04 )
+				c->rxFifo.get = c->rxFifo.put;
+		}
+		break;
+	case IDX_CHM_A:
+		m->ch[0].chm = val;
+		break;
+	case IDX_CHM_B:
+		m->ch[1].chm = val;
+		break;
+	}
+
+}
+
+/********************************* SIM_Read8 *******************************/
+/** Read byte from the module address space
+ *
+ *  \param ma         \IN  base address (ignored, one module)
+ *  \param offs       \IN  register offset
+ *
+ *  \return           register value
+ */
+u_int8 SIM_Read8( MACCESS ma, u_int32 offs )
+{
+	SIM_M75 *m = &G_m75;
+	u_int8 val;
+
+	pthread_mutex_lock( &m->lock );
+	Advance( m, SIM_TimeNs() );
+	val = Read8( m, offs );
+	pthread_cond_signal( &m->cond );
+	pthread_mutex_unlock( &m->lock );
+	return val;
+}
+
+/********************************* SIM_Write8 ******************************/
+/** Write byte to the module address space
+ *
+ *  \param ma         \IN  base address (ignored, one module)
+ *  \param offs       \IN  register offset
+ *  \param val        \IN  value
+ */
+void SIM_Write8( MACCESS ma, u_int32 offs, u_int8 val )
+{
+	SIM_M75 *m = &G_m75;
+
+	pthread_mutex_lock( &m->lock );
+	Advance( m, SIM_TimeNs() );
+	Write8( m, offs, val );
+	pthread_cond_signal( &m->cond );
+	pthread_mutex_unlock( &m->lock );
+}
+
+/********************************* SIM_FifoRead8 ***************************/
+/** Read bytes from one register, as one bus burst
+ *
+ *  The whole burst is atomic to the wire engine: on the module the
+ *  bus is much faster than the serial line, a host thread is not.
+ *
+ *  \param ma         \IN  base address (ignored, one module)
+ *  \param offs       \IN  register offset
+ *  \param n          \IN  number of bytes
+ *  \param buf        \OUT data
+ */
+void SIM_FifoRead8( MACCESS ma, u_int32 offs, u_int32 n, u_int8 *buf )
+{
+	SIM_M75 *m = &G_m75;
+
+	pthread_mutex_lock( &m->lock );
+	Advance( m, SIM_TimeNs() );
+	while( n-- )
+		*buf++ = Read8( m, offs );
+	pthread_cond_signal( &m->cond );
+	pthread_mutex_unlock( &m->lock );
+}
+
+/********************************* SIM_FifoWrite8 **************************/
+/** Write bytes to one register, as one bus burst
+ *
+ *  \param ma         \IN  base address (ignored, one module)
+ *  \param offs       \IN  register offset
+ *  \param n          \IN  number of bytes
+ *  \param buf        \IN  data
+ */
+void SIM_FifoWrite8( MACCESS ma, u_int32 offs, u_int32 n, const u_int8 *buf )
+{
+	SIM_M75 *m = &G_m75;
+
+	pthread_mutex_lock( &m->lock );
+	Advance( m, SIM_TimeNs() );
+	while( n-- )
+		Write8( m, offs, *buf++ );
+	pthread_cond_signal( &m->cond );
+	pthread_mutex_unlock( &m->lock );
+}
+
+/********************************* SIM_IdPromRead **************************/
+/** Read word from the module ID PROM
+ *
+ *  \param index      \IN  word index
+ *
+ *  \return           ID PROM word
+ */
+u_int16 SIM_IdPromRead( u_int8 index )
+{
+	switch( index ) {
+	case 0:  return 0x5346;		/* magic */
+	case 1:  return 75;			/* module ID */
+	case 2:  return 6;			/* revision */
+	default: return 0;
+	}
+}
+
+/*--------------------------------------+
+|   WIRE ENGINE                         |
++--------------------------------------*/
+static void *Engine( void *arg )
+{
+	SIM_M75 *m = (SIM_M75*)arg;
+	int32 (*isr)(void *arg);
+	void *isrArg;
+	OSS_IRQ_STATE irqState;
+	struct timespec ts;
+	u_int64 now, next, lineAt = 0;
+	u_int32 calls = 0;
+	int line;
+
+	pthread_mutex_lock( &m->lock );
+	while( m->run ) {
+		now = SIM_TimeNs();
+		Advance( m, now );
+
+		line = m->irqEn && m->isr && IrqLine(m);
+		if( !line )
+			lineAt = 0;
+		else if( !lineAt )
+			lineAt = now;
+
+		if( line && now - lineAt >= m->irqDelayNs && calls < STORM_CALLS ) {
+			/* interrupt line asserted: call ISR with interrupts masked */
+			pthread_mutex_unlock( &m->lock );
+			irqState = OSS_IrqMaskR( NULL, NULL );
+			pthread_mutex_lock( &m->lock );
+			/* may have been disconnected meanwhile */
+			isr	   = m->irqEn ? m->isr : NULL;
+			isrArg = m->isrArg;
+			m->inIsr = TRUE;
+			pthread_mutex_unlock( &m->lock );
+			if( isr ) {
+				SIM_IrqContext( TRUE );
+				isr( isrArg );
+				SIM_IrqContext( FALSE );
+			}
+			pthread_mutex_lock( &m->lock );
+			m->inIsr = FALSE;
+			pthread_mutex_unlock( &m->lock );
+			OSS_IrqRestore( NULL, NULL, irqState );
+			pthread_mutex_lock( &m->lock );
+			calls++;
+			continue;
+		}
+
+		if( calls >= STORM_CALLS ) {
+			next = now + 1000000;	/* line stuck, let time pass */
+		} else {
+			next = NextEvent( m, now );
+			if( line && lineAt + m->irqDelayNs < next )
+				next = lineAt + m->irqDelayNs;
+		}
+		calls = 0;
+
+		ts.tv_sec  = next / NS_PER_SEC;
+		ts.tv_nsec = next % NS_PER_SEC;
+		pthread_cond_timedwait( &m->cond, &m->lock, &ts );
+	}
+	pthread_mutex_unlock( &m->lock );
+
+	return NULL;
+}
+
+/********************************* SIM_HwInit ******************************/
+/** Power on the module and start the wire engine
+ *
+ *  Environment keys:
+ *  - M75SIM_WIRE     loop (Tx to own Rx, default) or cross (ch A <-> ch B)
+ *  - M75SIM_CRC_ERR  corrupt the CRC of every n-th frame (0 = never)
+ *  - M75SIM_TRACE    trace frames on stderr
+ *  - M75SIM_IRQ_DELAY  call the ISR n usec after the line asserts, like a
+ *                     busy CPU (opens the window between IP and ISR)
+ *
+ *  \return           0 on success or error code
+ */
+int32 SIM_HwInit( void )
+{
+	SIM_M75 *m = &G_m75;
+	pthread_condattr_t ca;
+	char *val;
+	int ch;
+
+	pthread_mutex_lock( &m->lock );
+	for( ch=0; ch<SIM_CH_NUM; ch++ ) {
+		memset( &m->ch[ch], 0, sizeof(SIM_CHAN) );
+		ChanReset( &m->ch[ch] );
+	}
+	m->wr02 = 0;
+	m->wr09 = 0;
+
+	val = SIM_EnvKey( "WIRE" );
+	m->loop		   = !(val && !strcmp( val, "cross" ));
+	val = SIM_EnvKey( "CRC_ERR" );
+	m->crcErrEvery = val ? (u_int32)strtoul( val, NULL, 0 ) : 0;
+	val = SIM_EnvKey( "TRACE" );
+	m->trace	   = val ? (u_int32)strtoul( val, NULL, 0 ) : 0;
+	val = SIM_EnvKey( "IRQ_DELAY" );
+	m->irqDelayNs  = val ? strtoull( val, NULL, 0 ) * 1000ULL : 0;
+
+	m->irqEn = FALSE;
+	m->run	 = TRUE;
+	pthread_mutex_unlock( &m->lock );
+
+	pthread_condattr_init( &ca );
+	pthread_condattr_setclock( &ca, CLOCK_MONOTONIC );
+	pthread_cond_init( &m->cond, &ca );
+	pthread_condattr_destroy( &ca );
+
+	if( pthread_create( &m->thread, NULL, Engine, m ) )
+		return ERR_OS;
+
+	Trace( m, "module up, wire %s\n", m->loop ? "loop" : "cross" );
+	return 0;
+}
+
+/********************************* SIM_HwExit ******************************/
+/** Stop the wire engine
+ */
+void SIM_HwExit( void )
+{
+	SIM_M75 *m = &G_m75;
+
+	pthread_mutex_lock( &m->lock );
+	m->run = FALSE;
+	m->isr = NULL;
+	pthread_cond_signal( &m->cond );
+	pthread_mutex_unlock( &m->lock );
+
+	pthread_join( m->thread, NULL );
+	pthread_cond_destroy( &m->cond );
+}
+
+/********************************* SIM_IrqConnect **************************/
+/** Install interrupt service routine
+ *
+ *  \param isr        \IN  service routine, NULL to disconnect
+ *  \param arg        \IN  argument passed to isr
+ */
+void SIM_IrqConnect( int32 (*isr)(void *arg), void *arg )
+{
+	SIM_M75 *m = &G_m75;
+	OSS_IRQ_STATE irqState;
+
+	/* no ISR in progress when this returns */
+	irqState = OSS_IrqMaskR( NULL, NULL );
+	pthread_mutex_lock( &m->lock );
+	m->isr	  = isr;
+	m->isrArg = arg;
+	pthread_mutex_unlock( &m->lock );
+	OSS_IrqRestore( NULL, NULL, irqState );
+}
+
+/********************************* SIM_IrqEnable ***************************/
+/** Enable/disable the interrupt at the host interrupt controller
+ *
+ *  \param enable     \IN  TRUE to enable
+ */
+void SIM_IrqEnable( int32 enable )
+{
+	SIM_M75 *m = &G_m75;
+	OSS_IRQ_STATE irqState;
+
+	/* no ISR in progress when this returns */
+	irqState = OSS_IrqMaskR( NULL, NULL );
+	pthread_mutex_lock( &m->lock );
+	m->irqEn = enable;
+	pthread_cond_signal( &m->cond );
+	pthread_mutex_unlock( &m->lock );
+	OSS_IrqRestore( NULL, NULL, irqState );
+}
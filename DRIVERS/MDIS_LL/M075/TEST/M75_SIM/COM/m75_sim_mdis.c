@@ -0,0 +1,627 @@
+/*********************  P r o g r a m  -  M o d u l e ***********************/
+/*!
+ *        \file  m75_sim_mdis.c
+ *
+ *      \brief   Host MDIS API, USR_OSS and USR_UTL for the M75 simulator
+ *
+ *               A minimal in-process MDIS kernel: one M75 module, every
+ *               device name opens it. Paths carry the current channel,
+ *               block status codes pass the M_SG_BLOCK to the driver.
+ *               Interrupts are enabled at first open when the descriptor
+ *               key IRQ_ENABLE (M75SIM_IRQ_ENABLE) is set, or later by
+ *               M_MK_IRQ_ENABLE.
+ *
+ *               User signals sent by the driver are queued and delivered
+ *               to the handler in the calling thread when an M_xxx()
+ *               call returns and during UOS_Delay()/UOS_KeyPressed().
+ *
+ *     Required: -
+ *     \switches SIM_GETENTRY  driver entry (default M75_GetEntry)
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2004-2019, MEN Mikro Elektronik GmbH
+ ****************************************************************************/
+/*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/select.h>
+#include <MEN/men_typs.h>
+#include <MEN/oss.h>
+#include <MEN/desc.h>
+#include <MEN/maccess.h>
+#include <MEN/mdis_api.h>
+#include <MEN/mdis_err.h>
+#include <MEN/ll_defs.h>
+#include <MEN/ll_entry.h>
+#include <MEN/usr_oss.h>
+#include <MEN/usr_utl.h>
+#include "m75_sim.h"
+
+/*--------------------------------------+
+|   DEFINES                             |
++--------------------------------------*/
+#ifndef SIM_GETENTRY
+#	define SIM_GETENTRY	M75_GetEntry
+#endif
+
+#define SIM_PATH_NUM	16			/* max. open paths */
+#define SIM_MA_ADDR		0x10000		/* dummy module address */
+#define DELAY_SLICE_MS	10			/* signal delivery interval */
+
+/*--------------------------------------+
+|   TYPDEFS                             |
++--------------------------------------*/
+typedef struct {
+	LL_ENTRY		ll;				/* driver entries */
+	LL_HANDLE		*llHdl;			/* driver handle */
+	MACCESS			ma;				/* module address */
+	int32			openCnt;		/* open paths */
+	int32			chNum;			/* number of channels */
+	int32			irqEnable;		/* interrupt enabled */
+	u_int32			irqCount;		/* interrupts serviced by driver */
+} SIM_DEV;
+
+typedef struct {
+	int32			used;
+	int32			ch;				/* current channel */
+} SIM_PATH;
+
+/*--------------------------------------+
+|   EXTERNALS                           |
++--------------------------------------*/
+extern void SIM_GETENTRY( LL_ENTRY *drvP );
+
+/*--------------------------------------+
+|   GLOBALS                             |
++--------------------------------------*/
+static SIM_DEV  G_dev;
+static SIM_PATH G_path[SIM_PATH_NUM];
+static pthread_mutex_t G_apiLock = PTHREAD_MUTEX_INITIALIZER;
+
+static __thread u_int32 G_errno;
+
+static pthread_mutex_t G_sigLock = PTHREAD_MUTEX_INITIALIZER;
+static void (*G_sigHandler)( u_int32 sigCode );
+static u_int32 G_sigInstalled;		/* installed signals, bit per code */
+static u_int32 G_sigPending;		/* pending signals, bit per code */
+static int32   G_sigCount;			/* signals raised so far */
+
+/*--------------------------------------+
+|   PROTOTYPES                          |
++--------------------------------------*/
+static void SigDeliver( void );
+
+/*--------------------------------------+
+|   HELPERS                             |
++--------------------------------------*/
+static int32 Fail( int32 error )
+{
+	G_errno = error;
+	SigDeliver();
+	return -1;
+}
+
+static int32 Done( int32 retVal )
+{
+	SigDeliver();
+	return retVal;
+}
+
+static SIM_PATH *PathGet( MDIS_PATH path )
+{
+	if( path < 0 || path >= SIM_PATH_NUM || !G_path[path].used )
+		return NULL;
+	return &G_path[path];
+}
+
+static int32 Isr( void *arg )
+{
+	int32 retCode = G_dev.ll.irq( G_dev.llHdl );
+
+	if( retCode != LL_IRQ_DEV_NOT )
+		G_dev.irqCount++;
+	return retCode;
+}
+
+static int32 IrqEnable( SIM_PATH *p, int32 enable )
+{
+	int32 error;
+
+	/* as the MDIS kernel: enable at the controller, then at the device */
+	if( enable )
+		SIM_IrqEnable( TRUE );
+	error = G_dev.ll.setStat( G_dev.llHdl, M_MK_IRQ_ENABLE, p->ch, enable );
+	if( !enable || error )
+		SIM_IrqEnable( FALSE );
+	if( !error )
+		G_dev.irqEnable = enable;
+	return error;
+}
+
+/*
+ * M_MK_BLK_REV_ID: the driver returns its ident table,
+ * the kernel concatenates the ident strings
+ */
+static int32 RevId( SIM_PATH *p, M_SG_BLOCK *blk )
+{
+	MDIS_IDENT_FUNCT_TBL *tbl = NULL;
+	char *buf = (char*)blk->data, *id;
+	int32 error, n, len = 0;
+
+	error = G_dev.ll.getStat( G_dev.llHdl, M_MK_BLK_REV_ID, p->ch,
+							  (INT32_OR_64*)&tbl );
+	if( error )
+		return error;
+
+	len = snprintf( buf, blk->size, "MDIS kernel: M75 host simulator\n" );
+	for( n=0; tbl && n<MAX_ID_FUNCT && tbl->idCall[n].identCall; n++ ) {
+		id = tbl->idCall[n].identCall();
+		if( len < blk->size )
+			len += snprintf( buf+len, blk->size-len, "%s\n", id );
+	}
+	blk->size = (len < blk->size) ? len + 1 : blk->size;
+	return 0;
+}
+
+/*--------------------------------------+
+|   MDIS API                            |
++--------------------------------------*/
+MDIS_PATH M_open( const char *device )
+{
+	MDIS_PATH path;
+	INT32_OR_64 value64;
+	char *val;
+	int32 error = 0;
+
+	pthread_mutex_lock( &G_apiLock );
+
+	for( path=0; path<SIM_PATH_NUM && G_path[path].used; path++ )
+		;
+	if( path == SIM_PATH_NUM ) {
+		error = ERR_MK_ILL_PARAM;
+		goto ABORT;
+	}
+
+	if( G_dev.openCnt == 0 ) {
+		if( (error = SIM_HwInit()) )
+			goto ABORT;
+
+		SIM_GETENTRY( &G_dev.ll );
+		G_dev.ma = SIM_MA_ADDR;
+
+		/* lock mode is LL_LOCK_NONE: no device semaphore */
+		error = G_dev.ll.init( (DESC_SPEC*)device, NULL, &G_dev.ma, NULL,
+							   NULL, &G_dev.llHdl );
+		if( error ) {
+			SIM_HwExit();
+			goto ABORT;
+		}
+		SIM_IrqConnect( Isr, NULL );
+
+		G_dev.ll.getStat( G_dev.llHdl, M_LL_CH_NUMBER, 0, &value64 );
+		G_dev.chNum		= (int32)value64;
+		G_dev.irqCount	= 0;
+		G_dev.irqEnable = FALSE;
+	}
+
+	G_path[path].used = TRUE;
+	G_path[path].ch	  = 0;
+
+	if( G_dev.openCnt++ == 0 &&
+		(val = SIM_EnvKey( "IRQ_ENABLE" )) && strtoul( val, NULL, 0 ) ) {
+		if( (error = IrqEnable( &G_path[path], TRUE )) ) {
+			G_path[path].used = FALSE;
+			G_dev.openCnt--;
+			SIM_IrqConnect( NULL, NULL );
+			G_dev.ll.exit( &G_dev.llHdl );
+			SIM_HwExit();
+			goto ABORT;
+		}
+	}
+
+	pthread_mutex_unlock( &G_apiLock );
+	return Done( path );
+
+ABORT:
+	pthread_mutex_unlock( &G_apiLock );
+	return Fail( error );
+}
+
+int32 M_close( MDIS_PATH path )
+{
+	SIM_PATH *p;
+	int32 error = 0;
+
+	pthread_mutex_lock( &G_apiLock );
+
+	if( !(p = PathGet( path )) ) {
+		pthread_mutex_unlock( &G_apiLock );
+		return Fail( ERR_MK_ILL_PARAM );
+	}
+	p->used = FALSE;
+
+	if( --G_dev.openCnt == 0 ) {
+		SIM_IrqEnable( FALSE );
+		error = G_dev.ll.exit( &G_dev.llHdl );
+		SIM_IrqConnect( NULL, NULL );
+		SIM_HwExit();
+	}
+
+	pthread_mutex_unlock( &G_apiLock );
+	return error ? Fail( error ) : Done( 0 );
+}
+
+int32 M_getstat( MDIS_PATH path, int32 code, int32 *dataP )
+{
+	SIM_PATH *p;
+	INT32_OR_64 value64;
+	int32 error;
+
+	if( !(p = PathGet( path )) )
+		return Fail( ERR_MK_ILL_PARAM );
+
+	switch( code ) {
+	case M_MK_CH_CURRENT:
+		*dataP = p->ch;
+		return Done( 0 );
+	case M_MK_IRQ_ENABLE:
+		*dataP = G_dev.irqEnable;
+		return Done( 0 );
+	case M_MK_IRQ_COUNT:
+		*dataP = G_dev.irqCount;
+		return Done( 0 );
+	case M_MK_BLK_REV_ID:
+		error = RevId( p, (M_SG_BLOCK*)dataP );
+		return error ? Fail( error ) : Done( 0 );
+	}
+
+	if( code & M_MK_BLK_OF ) {
+		/* block code: driver gets the M_SG_BLOCK */
+		error = G_dev.ll.getStat( G_dev.llHdl, code, p->ch,
+								  (INT32_OR_64*)dataP );
+	} else {
+		value64 = *dataP;
+		error = G_dev.ll.getStat( G_dev.llHdl, code, p->ch, &value64 );
+		if( !error )
+			*dataP = (int32)value64;
+	}
+
+	return error ? Fail( error ) : Done( 0 );
+}
+
+int32 M_setstat( MDIS_PATH path, int32 code, INT32_OR_64 data )
+{
+	SIM_PATH *p;
+	int32 error;
+
+	if( !(p = PathGet( path )) )
+		return Fail( ERR_MK_ILL_PARAM );
+
+	switch( code ) {
+	case M_MK_CH_CURRENT:
+		if( data < 0 || data >= G_dev.chNum )
+			return Fail( ERR_MK_ILL_PARAM );
+		p->ch = (int32)data;
+		return Done( 0 );
+	case M_MK_IRQ_ENABLE:
+		error = IrqEnable( p, data ? TRUE : FALSE );
+		return error ? Fail( error ) : Done( 0 );
+	case M_MK_IRQ_COUNT:
+		G_dev.irqCount = (u_int32)data;
+		return Done( 0 );
+	}
+
+	error = G_dev.ll.setStat( G_dev.llHdl, code, p->ch, data );
+
+	return error ? Fail( error ) : Done( 0 );
+}
+
+int32 M_read( MDIS_PATH path, int32 *valueP )
+{
+	SIM_PATH *p;
+	int32 error;
+
+	if( !(p = PathGet( path )) )
+		return Fail( ERR_MK_ILL_PARAM );
+
+	error = G_dev.ll.read( G_dev.llHdl, p->ch, valueP );
+
+	return error ? Fail( error ) : Done( 0 );
+}
+
+int32 M_write( MDIS_PATH path, int32 value )
+{
+	SIM_PATH *p;
+	int32 error;
+
+	if( !(p = PathGet( path )) )
+		return Fail( ERR_MK_ILL_PARAM );
+
+	error = G_dev.ll.write( G_dev.llHdl, p->ch, value );
+
+	return error ? Fail( error ) : Done( 0 );
+}
+
+int32 M_getblock( MDIS_PATH path, u_int8 *buffer, int32 length )
+{
+	SIM_PATH *p;
+	int32 error, nbrRead = 0;
+
+	if( !(p = PathGet( path )) )
+		return Fail( ERR_MK_ILL_PARAM );
+
+	error = G_dev.ll.blockRead( G_dev.llHdl, p->ch, buffer, length,
+								&nbrRead );
+
+	return error ? Fail( error ) : Done( nbrRead );
+}
+
+int32 M_setblock( MDIS_PATH path, const u_int8 *buffer, int32 length )
+{
+	SIM_PATH *p;
+	int32 error, nbrWritten = 0;
+
+	if( !(p = PathGet( path )) )
+		return Fail( ERR_MK_ILL_PARAM );
+
+	error = G_dev.ll.blockWrite( G_dev.llHdl, p->ch, (void*)buffer, length,
+								 &nbrWritten );
+
+	return error ? Fail( error ) : Done( nbrWritten );
+}
+
+char *M_errstring( int32 errCode )
+{
+	static char buf[128];
+	const char *txt;
+
+	switch( errCode ) {
+	case ERR_SUCCESS:			txt = "no error";						break;
+	case ERR_MK_ILL_PARAM:		txt = "illegal parameter";				break;
+	case ERR_MK_NO_LLDRV:		txt = "no low-level driver";			break;
+	case ERR_MK_UNK_CODE:		txt = "unknown status code";			break;
+	case ERR_LL_ILL_PARAM:		txt = "illegal parameter";				break;
+	case ERR_LL_ILL_FUNC:		txt = "illegal function";				break;
+	case ERR_LL_UNK_CODE:		txt = "unknown status code";			break;
+	case ERR_LL_ILL_ID:			txt = "illegal module ID";				break;
+	case ERR_LL_USERBUF:		txt = "user buffer too small";			break;
+	case ERR_LL_READ:			txt = "read error";						break;
+	case ERR_LL_WRITE:			txt = "write error";					break;
+	case ERR_OSS_MEM_ALLOC:		txt = "can't allocate memory";			break;
+	case ERR_OSS_TIMEOUT:		txt = "timeout";						break;
+	case ERR_OSS_SIG_OCCURED:	txt = "signal occurred";				break;
+	case ERR_OSS_ILL_PARAM:		txt = "illegal parameter";				break;
+	case ERR_OSS_BUSY_RESOURCE:	txt = "resource busy";					break;
+	case ERR_DESC_KEY_NOTFOUND:	txt = "descriptor key not found";		break;
+	default:
+		txt = (errCode >= ERR_DEV && errCode <= ERR_END) ?
+			"device specific error" : "unknown error";
+	}
+
+	snprintf( buf, sizeof(buf), "ERROR (%s) 0x%04x:  %s",
+			  (errCode >= ERR_DEV && errCode <= ERR_END) ? "DEV" : "MDIS",
+			  errCode, txt );
+	return buf;
+}
+
+/*--------------------------------------+
+|   USER SIGNALS                        |
++--------------------------------------*/
+/********************************* SIM_SigRaise ****************************/
+/** Queue user signal (called by OSS_SigSend)
+ *
+ *  \param sigCode    \IN  signal code
+ */
+void SIM_SigRaise( int32 sigCode )
+{
+	pthread_mutex_lock( &G_sigLock );
+	if( sigCode > 0 && sigCode < 32 && (G_sigInstalled & (1 << sigCode)) ) {
+		G_sigPending |= 1 << sigCode;
+		G_sigCount++;
+	}
+	pthread_mutex_unlock( &G_sigLock );
+}
+
+/********************************* SIM_SigCount ****************************/
+/** Get number of signals raised so far
+ *
+ *  \return           signal counter
+ */
+int32 SIM_SigCount( void )
+{
+	int32 cnt;
+
+	pthread_mutex_lock( &G_sigLock );
+	cnt = G_sigCount;
+	pthread_mutex_unlock( &G_sigLock );
+	return cnt;
+}
+
+static void SigDeliver( void )
+{
+	void (*handler)( u_int32 sigCode );
+	u_int32 pend, sig;
+
+	pthread_mutex_lock( &G_sigLock );
+	pend		 = G_sigPending;
+	handler		 = G_sigHandler;
+	G_sigPending = 0;
+	pthread_mutex_unlock( &G_sigLock );
+
+	for( sig=1; pend && handler && sig<32; sig++ )
+		if( pend & (1 << sig) )
+			handler( sig );
+}
+
+/*--------------------------------------+
+|   USR_OSS                             |
++--------------------------------------*/
+char *UOS_Ident( void )
+{
+	return "UOS - M75 host simulator";
+}
+
+u_int32 UOS_ErrnoGet( void )
+{
+	return G_errno;
+}
+
+u_int32 UOS_ErrnoSet( u_int32 errCode )
+{
+	return G_errno = errCode;
+}
+
+int32 UOS_Delay( u_int32 msec )
+{
+	u_int64 end = SIM_TimeNs() + (u_int64)msec * 1000000ULL, now;
+	struct timespec ts;
+
+	while( (now = SIM_TimeNs()) < end ) {
+		now = end - now;
+		if( now > DELAY_SLICE_MS * 1000000ULL )
+			now = DELAY_SLICE_MS * 1000000ULL;
+		ts.tv_sec  = 0;
+		ts.tv_nsec = (long)now;
+		nanosleep( &ts, NULL );
+		SigDeliver();
+	}
+	return msec;
+}
+
+u_int32 UOS_MsecTimerGet( void )
+{
+	return (u_int32)(SIM_TimeNs() / 1000000ULL);
+}
+
+u_int32 UOS_MsecTimerResolution( void )
+{
+	return 1;
+}
+
+int32 UOS_KeyPressed( void )
+{
+	struct timeval tv = { 0, 0 };
+	fd_set fds;
+	char c;
+
+	SigDeliver();
+
+	FD_ZERO( &fds );
+	FD_SET( STDIN_FILENO, &fds );
+	if( select( STDIN_FILENO+1, &fds, NULL, NULL, &tv ) > 0 &&
+		read( STDIN_FILENO, &c, 1 ) == 1 )
+		return (u_int8)c;
+
+	return -1;
+}
+
+int32 UOS_SigInit( void (*sigHandler)(u_int32 sigCode) )
+{
+	pthread_mutex_lock( &G_sigLock );
+	G_sigHandler = sigHandler;
+	pthread_mutex_unlock( &G_sigLock );
+	return 0;
+}
+
+int32 UOS_SigExit( void )
+{
+	pthread_mutex_lock( &G_sigLock );
+	G_sigHandler   = NULL;
+	G_sigInstalled = 0;
+	G_sigPending   = 0;
+	pthread_mutex_unlock( &G_sigLock );
+	return 0;
+}
+
+int32 UOS_SigInstall( u_int32 sigCode )
+{
+	if( sigCode == 0 || sigCode >= 32 )
+		return ERR_OSS_ILL_PARAM;
+
+	pthread_mutex_lock( &G_sigLock );
+	G_sigInstalled |= 1 << sigCode;
+	pthread_mutex_unlock( &G_sigLock );
+	return 0;
+}
+
+int32 UOS_SigRemove( u_int32 sigCode )
+{
+	if( sigCode == 0 || sigCode >= 32 )
+		return ERR_OSS_ILL_PARAM;
+
+	pthread_mutex_lock( &G_sigLock );
+	G_sigInstalled &= ~(1 << sigCode);
+	G_sigPending   &= ~(1 << sigCode);
+	pthread_mutex_unlock( &G_sigLock );
+	return 0;
+}
+
+/*--------------------------------------+
+|   USR_UTL                             |
++--------------------------------------*/
+char *UTL_Ident( void )
+{
+	return "UTL - M75 host simulator";
+}
+
+/*
+ * option "x=" returns the string after -x=,
+ * option "x" returns the argument containing -x
+ */
+char *UTL_Tstopt( int argc, char **argv, const char *option, char *errstr )
+{
+	size_t len = strlen( option );
+	int i;
+
+	for( i=1; i<argc; i++ ) {
+		if( argv[i][0] != '-' )
+			continue;
+		if( len && option[len-1] == '=' ) {
+			if( !strncmp( argv[i]+1, option, len ) )
+				return argv[i]+1+len;
+		} else if( !strchr( argv[i], '=' ) && strchr( argv[i]+1, option[0] ) ) {
+			return argv[i];
+		}
+	}
+	return NULL;
+}
+
+/*
+ * opts lists the valid options, a trailing '=' marks an option
+ * with value (e.g. "s=n=vr")
+ */
+char *UTL_Illiopt( int argc, char **argv, const char *opts, char *errstr )
+{
+	const char *o;
+	int i;
+
+	for( i=1; i<argc; i++ ) {
+		if( argv[i][0] != '-' )
+			continue;
+		for( o=opts; *o && *o != argv[i][1]; o++ )
+			;
+		if( !*o || (o[1] == '=') != (argv[i][2] == '=') ) {
+			sprintf( errstr, "*** illegal option: %s", argv[i] );
+			return errstr;
+		}
+	}
+	return NULL;
+}
@@ -0,0 +1,583 @@
+/*********************  P r o g r a m  -  M o d u l e ***********************/
+/*!
+ *        \file  m75_sim_oss.c
+ *
+ *      \brief   Host OSS, DESC and DBG services for the M75 simulator
+ *
+ *               Kernel services used by m75_drv.c, implemented on pthreads:
+ *               - OSS_IrqMaskR/OSS_IrqRestore take a lock that the wire
+ *                 engine also holds while calling the ISR, so masked
+ *                 sections and the ISR exclude each other as on a target;
+ *                 masking again outside the ISR aborts, as does
+ *                 OSS_AlarmClear() with interrupts masked
+ *               - semaphores, signals, alarms (alarm routines run with
+ *                 interrupts enabled, like on most targets; setting an
+ *                 active alarm fails as in MDIS OSS), delays, ticks (1 kHz)
+ *               - descriptor keys are read from the environment:
+ *                 key CHAN_0/MAX_RXFRAME_NUM is M75SIM_CHAN_0_MAX_RXFRAME_NUM
+ *               - m_read() returns the simulated ID PROM
+ *
+ *     Required: -
+ *     \switches DBG
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2004-2019, MEN Mikro Elektronik GmbH
+ ****************************************************************************/
+/*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <pthread.h>
+#include <MEN/men_typs.h>
+#include <MEN/dbg.h>
+#include <MEN/oss.h>
+#include <MEN/desc.h>
+#include <MEN/modcom.h>
+#include <MEN/mdis_err.h>
+#include "m75_sim.h"
+
+/*--------------------------------------+
+|   DEFINES                             |
++--------------------------------------*/
+#define SEM_POLL_MS		10		/* signal check interval while waiting */
+#define IRQ_STATE_ISR	1		/* OSS_IrqMaskR() in ISR, nothing to restore */
+
+/*--------------------------------------+
+|   TYPDEFS                             |
++--------------------------------------*/
+struct OSS_SEM_HANDLE {
+	pthread_mutex_t	lock;
+	pthread_cond_t	cond;
+	int32			type;
+	int32			val;
+};
+
+struct OSS_SIG_HANDLE {
+	int32			sigCode;
+};
+
+struct OSS_ALARM_HANDLE {
+	void			(*funct)(void *arg);
+	void			*arg;
+	pthread_t		thread;
+	pthread_mutex_t	lock;
+	pthread_cond_t	cond;
+	int32			active;
+	int32			cyclic;
+	int32			quit;
+	u_int64			periodNs;
+	u_int64			due;
+};
+
+struct DESC_HANDLE {
+	DESC_SPEC		*spec;
+};
+
+/*--------------------------------------+
+|   GLOBALS                             |
++--------------------------------------*/
+static pthread_mutex_t G_irqLock;
+static pthread_once_t G_irqOnce = PTHREAD_ONCE_INIT;
+static __thread int32 G_inIsr;		/* thread runs the ISR */
+static __thread int32 G_masked;		/* thread holds G_irqLock */
+
+/*--------------------------------------+
+|   HELPERS                             |
++--------------------------------------*/
+/********************************* SIM_TimeNs ******************************/
+/** Get monotonic time
+ *
+ *  \return           time [ns]
+ */
+u_int64 SIM_TimeNs( void )
+{
+	struct timespec ts;
+
+	clock_gettime( CLOCK_MONOTONIC, &ts );
+	return (u_int64)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/********************************* SIM_EnvKey ******************************/
+/** Look up simulator key in the environment
+ *
+ *  The key is prefixed with M75SIM_, uppercased and '/' replaced by '_'.
+ *
+ *  \param key        \IN  key name, e.g. "CHAN_0/SYNC_MODE"
+ *
+ *  \return           value string or NULL if not set
+ */
+char *SIM_EnvKey( const char *key )
+{
+	char name[128];
+	size_t n = strlen( SIM_ENV_PREFIX );
+
+	strcpy( name, SIM_ENV_PREFIX );
+	for( ; *key && n < sizeof(name)-1; key++ )
+		name[n++] = (*key == '/') ? '_' : (char)toupper( (unsigned char)*key );
+	name[n] = '\0';
+
+	return getenv( name );
+}
+
+static void AbsTime( struct timespec *ts, u_int64 ns )
+{
+	ts->tv_sec	= ns / 1000000000ULL;
+	ts->tv_nsec = ns % 1000000000ULL;
+}
+
+/*--------------------------------------+
+|   OSS                                 |
++--------------------------------------*/
+char *OSS_Ident( void )
+{
+	return "OSS - M75 host simulator";
+}
+
+void *OSS_MemGet( OSS_HANDLE *osHdl, u_int32 size, u_int32 *gotsizeP )
+{
+	void *mem = malloc( size );
+
+	*gotsizeP = mem ? size : 0;
+	return mem;
+}
+
+int32 OSS_MemFree( OSS_HANDLE *osHdl, void *addr, u_int32 size )
+{
+	free( addr );
+	return 0;
+}
+
+void OSS_MemFill( OSS_HANDLE *osHdl, u_int32 size, char *adr, int8 value )
+{
+	memset( adr, value, size );
+}
+
+void OSS_MemCopy( OSS_HANDLE *osHdl, u_int32 size, char *src, char *dest )
+{
+	memmove( dest, src, size );
+}
+
+/*---------------- interrupts ----------------*/
+static void IrqLockInit( void )
+{
+	pthread_mutexattr_t ma;
+
+	pthread_mutexattr_init( &ma );
+	pthread_mutexattr_settype( &ma, PTHREAD_MUTEX_ERRORCHECK );
+	pthread_mutex_init( &G_irqLock, &ma );
+	pthread_mutexattr_destroy( &ma );
+}
+
+static void IrqAbort( const char *func, const char *what )
+{
+	fprintf( stderr, "*** M75SIM: %s: %s\n", func, what );
+	abort();
+}
+
+/********************************* SIM_IrqContext **************************/
+/** Mark the calling thread as running the ISR
+ *
+ *  Called by the wire engine around the ISR, which it calls masked.
+ *  In the ISR OSS_IrqMaskR() is allowed and does nothing, as on a target.
+ *
+ *  \param inIsr      \IN  TRUE: ISR starts, FALSE: ISR returned
+ */
+void SIM_IrqContext( int32 inIsr )
+{
+	G_inIsr = inIsr;
+}
+
+OSS_IRQ_STATE OSS_IrqMaskR( OSS_HANDLE *osHdl, OSS_IRQ_HANDLE *irqHdl )
+{
+	if( G_inIsr )
+		return IRQ_STATE_ISR;
+
+	pthread_once( &G_irqOnce, IrqLockInit );
+	if( pthread_mutex_lock( &G_irqLock ) )
+		IrqAbort( "OSS_IrqMaskR", "interrupts already masked" );
+	G_masked = TRUE;
+	return 0;
+}
+
+void OSS_IrqRestore( OSS_HANDLE *osHdl, OSS_IRQ_HANDLE *irqHdl,
+					 OSS_IRQ_STATE oldState )
+{
+	if( oldState == IRQ_STATE_ISR )
+		return;
+
+	G_masked = FALSE;
+	if( pthread_mutex_unlock( &G_irqLock ) )
+		IrqAbort( "OSS_IrqRestore", "interrupts not masked" );
+}
+
+/*---------------- semaphores ----------------*/
+int32 OSS_SemCreate( OSS_HANDLE *osHdl, int32 semType, int32 initVal,
+					 OSS_SEM_HANDLE **semP )
+{
+	OSS_SEM_HANDLE *sem;
+	pthread_condattr_t ca;
+
+	if( semType != OSS_SEM_BIN && semType != OSS_SEM_COUNT )
+		return ERR_OSS_ILL_PARAM;
+	if( !(sem = (OSS_SEM_HANDLE*)calloc( 1, sizeof(*sem) )) )
+		return ERR_OSS_MEM_ALLOC;
+
+	pthread_mutex_init( &sem->lock, NULL );
+	pthread_condattr_init( &ca );
+	pthread_condattr_setclock( &ca, CLOCK_MONOTONIC );
+	pthread_cond_init( &sem->cond, &ca );
+	pthread_condattr_destroy( &ca );
+	sem->type = semType;
+	sem->val  = (semType == OSS_SEM_BIN && initVal) ? 1 : initVal;
+
+	*semP = sem;
+	return 0;
+}
+
+int32 OSS_SemRemove( OSS_HANDLE *osHdl, OSS_SEM_HANDLE **semHandleP )
+{
+	OSS_SEM_HANDLE *sem = *semHandleP;
+
+	if( sem ) {
+		pthread_cond_destroy( &sem->cond );
+		pthread_mutex_destroy( &sem->lock );
+		free( sem );
+		*semHandleP = NULL;
+	}
+	return 0;
+}
+
+/*
+ * A user signal raised while waiting aborts the wait,
+ * like an interruptible wait in a target kernel.
+ */
+int32 OSS_SemWait( OSS_HANDLE *osHdl, OSS_SEM_HANDLE *sem, int32 msec )
+{
+	u_int64 now = SIM_TimeNs(), end, slice;
+	int32 sigCnt = SIM_SigCount(), error = 0;
+	struct timespec ts;
+
+	end = (msec > 0) ? now + (u_int64)msec * 1000000ULL : 0;
+
+	pthread_mutex_lock( &sem->lock );
+	while( sem->val == 0 ) {
+		if( msec == 0 || (end && now >= end) ) {
+			error = ERR_OSS_TIMEOUT;
+			break;
+		}
+		if( SIM_SigCount() != sigCnt ) {
+			error = ERR_OSS_SIG_OCCURED;
+			break;
+		}
+		slice = now + SEM_POLL_MS * 1000000ULL;
+		if( end && end < slice )
+			slice = end;
+		AbsTime( &ts, slice );
+		pthread_cond_timedwait( &sem->cond, &sem->lock, &ts );
+		now = SIM_TimeNs();
+	}
+	if( !error )
+		sem->val--;
+	pthread_mutex_unlock( &sem->lock );
+
+	return error;
+}
+
+int32 OSS_SemSignal( OSS_HANDLE *osHdl, OSS_SEM_HANDLE *sem )
+{
+	pthread_mutex_lock( &sem->lock );
+	if( sem->type == OSS_SEM_COUNT || sem->val == 0 )
+		sem->val++;
+	pthread_cond_signal( &sem->cond );
+	pthread_mutex_unlock( &sem->lock );
+	return 0;
+}
+
+/*---------------- signals ----------------*/
+int32 OSS_SigCreate( OSS_HANDLE *osHdl, int32 signal,
+					 OSS_SIG_HANDLE **sigHandleP )
+{
+	OSS_SIG_HANDLE *sig;
+
+	if( !(sig = (OSS_SIG_HANDLE*)malloc( sizeof(*sig) )) )
+		return ERR_OSS_MEM_ALLOC;
+	sig->sigCode = signal;
+	*sigHandleP = sig;
+	return 0;
+}
+
+int32 OSS_SigRemove( OSS_HANDLE *osHdl, OSS_SIG_HANDLE **sigHandleP )
+{
+	free( *sigHandleP );
+	*sigHandleP = NULL;
+	return 0;
+}
+
+int32 OSS_SigSend( OSS_HANDLE *osHdl, OSS_SIG_HANDLE *sigHandle )
+{
+	SIM_SigRaise( sigHandle->sigCode );
+	return 0;
+}
+
+/*---------------- timing ----------------*/
+void OSS_MikroDelay( OSS_HANDLE *osHdl, u_int32 usec )
+{
+	u_int64 end = SIM_TimeNs() + (u_int64)usec * 1000ULL;
+
+	while( SIM_TimeNs() < end )
+		;
+}
+
+int32 OSS_Delay( OSS_HANDLE *osHdl, int32 msec )
+{
+	struct timespec ts;
+
+	ts.tv_sec  = msec / 1000;
+	ts.tv_nsec = (msec % 1000) * 1000000L;
+	nanosleep( &ts, NULL );
+	return msec;
+}
+
+u_int32 OSS_TickGet( OSS_HANDLE *osHdl )
+{
+	return (u_int32)(SIM_TimeNs() / 1000000ULL);
+}
+
+int32 OSS_TickRateGet( OSS_HANDLE *osHdl )
+{
+	return 1000;
+}
+
+/*---------------- alarms ----------------*/
+static void *AlarmThread( void *arg )
+{
+	OSS_ALARM_HANDLE *alm = (OSS_ALARM_HANDLE*)arg;
+	struct timespec ts;
+
+	pthread_mutex_lock( &alm->lock );
+	while( !alm->quit ) {
+		if( !alm->active ) {
+			pthread_cond_wait( &alm->cond, &alm->lock );
+			continue;
+		}
+		if( SIM_TimeNs() < alm->due ) {
+			AbsTime( &ts, alm->due );
+			pthread_cond_timedwait( &alm->cond, &alm->lock, &ts );
+			continue;
+		}
+		if( alm->cyclic )
+			alm->due += alm->periodNs;
+		else
+			alm->active = FALSE;
+		pthread_mutex_unlock( &alm->lock );
+
+		/* alarm routines mask interrupts themselves */
+		alm->funct( alm->arg );
+
+		pthread_mutex_lock( &alm->lock );
+	}
+	pthread_mutex_unlock( &alm->lock );
+	return NULL;
+}
+
+int32 OSS_AlarmCreate( OSS_HANDLE *osHdl, void (*funct)(void *arg),
+					   void *arg, OSS_ALARM_HANDLE **alarmP )
+{
+	OSS_ALARM_HANDLE *alm;
+	pthread_condattr_t ca;
+
+	if( !(alm = (OSS_ALARM_HANDLE*)calloc( 1, sizeof(*alm) )) )
+		return ERR_OSS_MEM_ALLOC;
+
+	alm->funct = funct;
+	alm->arg   = arg;
+	pthread_mutex_init( &alm->lock, NULL );
+	pthread_condattr_init( &ca );
+	pthread_condattr_setclock( &ca, CLOCK_MONOTONIC );
+	pthread_cond_init( &alm->cond, &ca );
+	pthread_condattr_destroy( &ca );
+
+	if( pthread_create( &alm->thread, NULL, AlarmThread, alm ) ) {
+		free( alm );
+		return ERR_OSS_MEM_ALLOC;
+	}
+	*alarmP = alm;
+	return 0;
+}
+
+int32 OSS_AlarmRemove( OSS_HANDLE *osHdl, OSS_ALARM_HANDLE **alarmP )
+{
+	OSS_ALARM_HANDLE *alm = *alarmP;
+
+	if( !alm )
+		return 0;
+
+	pthread_mutex_lock( &alm->lock );
+	alm->quit = TRUE;
+	pthread_cond_signal( &alm->cond );
+	pthread_mutex_unlock( &alm->lock );
+
+	if( pthread_equal( pthread_self(), alm->thread ) ) {
+		/* removed by its own routine, thread ends after return */
+		pthread_detach( alm->thread );
+	} else {
+		pthread_join( alm->thread, NULL );
+		pthread_cond_destroy( &alm->cond );
+		pthread_mutex_destroy( &alm->lock );
+		free( alm );
+	}
+	*alarmP = NULL;
+	return 0;
+}
+
+int32 OSS_AlarmSet( OSS_HANDLE *osHdl, OSS_ALARM_HANDLE *alm,
+					u_int32 msec, u_int32 cyclic, u_int32 *realMsecP )
+{
+	if( !msec )
+		msec = 1;
+
+	pthread_mutex_lock( &alm->lock );
+	if( alm->active ) {
+		/* like MDIS OSS: no re-arm of an active alarm */
+		pthread_mutex_unlock( &alm->lock );
+		return ERR_OSS_ALARM_SET;
+	}
+	alm->periodNs = (u_int64)msec * 1000000ULL;
+	alm->due	  = SIM_TimeNs() + alm->periodNs;
+	alm->cyclic	  = cyclic;
+	alm->active	  = TRUE;
+	pthread_cond_signal( &alm->cond );
+	pthread_mutex_unlock( &alm->lock );
+
+	if( realMsecP )
+		*realMsecP = msec;
+	return 0;
+}
+
+int32 OSS_AlarmClear( OSS_HANDLE *osHdl, OSS_ALARM_HANDLE *alm )
+{
+	int32 error = 0;
+
+	if( G_inIsr || G_masked )
+		IrqAbort( "OSS_AlarmClear", "called with interrupts masked" );
+
+	pthread_mutex_lock( &alm->lock );
+	if( !alm->active )
+		error = ERR_OSS_ALARM_CLR;
+	alm->active = FALSE;
+	pthread_cond_signal( &alm->cond );
+	pthread_mutex_unlock( &alm->lock );
+	return error;
+}
+
+/*--------------------------------------+
+|   DESC                                |
++--------------------------------------*/
+char *DESC_Ident( void )
+{
+	return "DESC - M75 host simulator (environment)";
+}
+
+int32 DESC_Init( DESC_SPEC *descSpec, OSS_HANDLE *osHdl,
+				 DESC_HANDLE **descHandleP )
+{
+	DESC_HANDLE *desc;
+
+	if( !(desc = (DESC_HANDLE*)malloc( sizeof(*desc) )) )
+		return ERR_OSS_MEM_ALLOC;
+	desc->spec = descSpec;
+	*descHandleP = desc;
+	return 0;
+}
+
+int32 DESC_Exit( DESC_HANDLE **descHandleP )
+{
+	free( *descHandleP );
+	*descHandleP = NULL;
+	return 0;
+}
+
+int32 DESC_DbgLevelSet( DESC_HANDLE *descHandle, u_int32 dbgLevel )
+{
+	return 0;
+}
+
+int32 DESC_GetUInt32( DESC_HANDLE *descHandle, u_int32 defVal,
+					  u_int32 *valueP, char *keyFmt, ... )
+{
+	char key[64], *val;
+	va_list ap;
+
+	va_start( ap, keyFmt );
+	vsnprintf( key, sizeof(key), keyFmt, ap );
+	va_end( ap );
+
+	if( !(val = SIM_EnvKey( key )) ) {
+		*valueP = defVal;
+		return ERR_DESC_KEY_NOTFOUND;
+	}
+	*valueP = (u_int32)strtoul( val, NULL, 0 );
+	return 0;
+}
+
+/*--------------------------------------+
+|   DBG                                 |
++--------------------------------------*/
+int32 DBG_Init( char *name, DBG_HANDLE **dbgP )
+{
+	*dbgP = (DBG_HANDLE*)stderr;
+	return 0;
+}
+
+int32 DBG_Exit( DBG_HANDLE **dbgP )
+{
+	*dbgP = NULL;
+	return 0;
+}
+
+int32 DBG_Write( DBG_HANDLE *dbg, char *frmt, ... )
+{
+	va_list ap;
+
+	va_start( ap, frmt );
+	vfprintf( stderr, frmt, ap );
+	va_end( ap );
+	return 0;
+}
+
+int32 DBG_Memdump( DBG_HANDLE *dbg, char *txt, void *buf, u_int32 len,
+				   u_int32 fmt )
+{
+	u_int32 i;
+
+	fprintf( stderr, "%s (%u bytes)", txt, len );
+	for( i=0; i<len; i++ )
+		fprintf( stderr, "%s%02x", (i % 16) ? " " : "\n  ",
+				 ((u_int8*)buf)[i] );
+	fprintf( stderr, "\n" );
+	return 0;
+}
+
+/*--------------------------------------+
+|   ID PROM                             |
++--------------------------------------*/
+int m_read( U_INT32_OR_64 addr, u_int8 index )
+{
+	return SIM_IdPromRead( index );
+}
@@ -1435,7 +1435,6 @@ int32 m75_test_Rx(MDIS_PATH fdHdl,
 	if( filename )
 		if( (fileH = fopen( filename, "w" )) == NULL ){
 			printf("\n*** cannot open file %s\n",filename);
-			fprintf(fileH, "This is a test");
 			goto M75_ERR;
 		}
 	if( fileH )
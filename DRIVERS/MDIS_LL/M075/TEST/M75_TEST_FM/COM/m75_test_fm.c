@@ -149,10 +149,12 @@ static int32 m75_getFrame(MDIS_PATH fdHdl,
 						  int32 *nbrOfBytesReceived,
 						  u_int8 *m75_RxBuf,
 						  u_int8 verbose);
+#ifdef M75_RETURN_RX
 static int32 m75_verifyFrame(u_int8 *frame1,
 							 u_int8 *frame2,
 							 u_int32 len,
 							 u_int8 verbose);
+#endif
 
 static void m75_printFrame( FILE *fileH,
 							u_int8 *frame,
@@ -1210,6 +1212,7 @@ int32 m75_getFrame(MDIS_PATH fdHdl, FILE *fileH, int32 *nbrOfBytesReceived,
 }
 
 
+#ifdef M75_RETURN_RX
 /**************************** m75_verifyFrame ********************************/
 /*! Verify frames in buffers
  *
@@ -1244,6 +1247,7 @@ int32 m75_verifyFrame(	u_int8 *frame1,
 		printf("==> Verification O.K.\n");
 	return(0);
 }
+#endif /* M75_RETURN_RX */
 /**************************** m75_printFrame ********************************/
 /*! Print frame to file or stdout
  *
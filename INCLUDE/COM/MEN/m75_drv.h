@@ -42,6 +42,15 @@
 /*-----------------------------------------+
 |  TYPEDEFS                                |
 +-----------------------------------------*/
+#define M75_STATS_HIST_NUM	12
+/**< number of frame size histogram bins in M75_STATS, bin n counts frames
+ *   of 2^n..2^(n+1)-1 bytes, bin 0 includes empty frames, the last bin all
+ *   larger frames */
+
+#define M75_IRQSTATS_HIST_NUM	16
+/**< number of histogram bins in M75_IRQSTATS, bin n counts values of
+ *   2^n..2^(n+1)-1, bin 0 includes 0, the last bin all larger values */
+
 /**@{*/
 /** Structure for passing data with M75_SCC_REGS Getstat */
 typedef struct {
@@ -61,6 +70,72 @@ typedef struct {
 	u_int8			wr14;	/**< SCC register WR14  */
 	u_int8			wr15;	/**< SCC register WR15  */
 } M75_SCC_REGS_PB;
+
+/** Record header for M_getblock data in batch mode (M75_RX_BATCH) */
+typedef struct {
+	u_int16			size;	/**< number of frame bytes following the header */
+	u_int16			flags;	/**< record flags (M75_RXREC_xxx) */
+	u_int32			tstamp;	/**< arrival time of frame (see M75_TSTAMP_RATE) */
+} M75_RX_REC_HDR;
+
+/** Structure for passing data with M75_BLK_STATS/M75_BLK_STATS_CLR Getstat */
+typedef struct {
+	u_int32			rxFrames;	/**< frames received */
+	u_int32			rxBytes;	/**< bytes received */
+	u_int32			txFrames;	/**< frames transmitted */
+	u_int32			txBytes;	/**< bytes transmitted */
+	u_int32			rxCrcErr;	/**< CRC/framing or parity errors */
+	u_int32			rxOverrun;	/**< Rx overrun errors */
+	u_int32			rxStatOvfl;	/**< Status FIFO overflows */
+	u_int32			rxQFull;	/**< Rx interrupts with Rx queue full */
+	u_int32			rxTooLarge;	/**< frames dropped, larger than max. frame size */
+	u_int32			txQFull;	/**< M_setblock calls finding Tx queue full */
+	u_int32			breakAbort;	/**< Break/Abort events */
+	u_int32			irqRx;		/**< Rx interrupts */
+	u_int32			irqTx;		/**< Tx interrupts */
+	u_int32			irqExt;		/**< Ext/Status interrupts */
+	u_int32			rxPollSwitch;/**< switches to Rx polling mode (M75_RX_POLL_HI) */
+	u_int32			rxIrqTime;	/**< time in Rx interrupt mode (timestamp ticks) */
+	u_int32			rxPollTime;	/**< time in Rx polling mode (timestamp ticks) */
+	u_int32			rxBudgetOut;/**< Rx services stopped by work budget (M75_RX_BUDGET) */
+	u_int32			irqStorm;	/**< storm backoffs, sources disabled by storm detection */
+	u_int32			irqStormRearm;/**< sources re-enabled after storm backoff */
+	u_int32			txDoneLost;	/**< Tx completions overwritten, not read in time */
+	u_int32			rxSig;		/**< Rx signals sent for received frames (M75_RX_SIG_FRAMES) */
+	u_int32			rxSizeHist[M75_STATS_HIST_NUM];
+								/**< Rx frame sizes, see M75_STATS_HIST_NUM */
+	u_int32			txSizeHist[M75_STATS_HIST_NUM];
+								/**< Tx frame sizes, see M75_STATS_HIST_NUM */
+} M75_STATS;
+
+/** Structure for passing data with M75_BLK_IRQSTATS Getstat
+ *  (driver built with M75_IRQ_STATS only) */
+typedef struct {
+	u_int32			irqNum;		/**< ISR calls for the device */
+	u_int32			maxIrqTime;	/**< longest ISR duration (timestamp ticks) */
+	u_int32			maxLoops;	/**< most RR03 loops per ISR call */
+	u_int32			maxRxFrames;/**< most frames per Rx interrupt */
+	u_int32			timeHist[M75_IRQSTATS_HIST_NUM];
+								/**< ISR duration (timestamp ticks) */
+	u_int32			loopHist[M75_IRQSTATS_HIST_NUM];
+								/**< RR03 loops per ISR call */
+	u_int32			rxFramesHist[M75_IRQSTATS_HIST_NUM];
+								/**< frames per Rx interrupt */
+} M75_IRQSTATS;
+
+/** Record header for M_setblock data in batch mode (M75_TX_BATCH) */
+typedef struct {
+	u_int16			size;	/**< number of frame bytes following the header */
+	u_int16			flags;	/**< reserved, set to 0 */
+} M75_TX_REC_HDR;
+
+/** Tx completion record returned by M75_BLK_TX_DONE Getstat (SYNC mode) */
+typedef struct {
+	u_int32			id;		/**< frame id, see M75_TX_ID */
+	u_int32			tQueued;/**< time frame was passed with M_setblock */
+	u_int32			tDone;	/**< time frame data was sent (Tx Underrun/EOM),
+							 *   timestamps see M75_TSTAMP_RATE */
+} M75_TX_DONE;
 /**@}*/
 /*-----------------------------------------+
 |  DEFINES                                 |
@@ -453,6 +528,278 @@ typedef struct {
  *.  2,457,600	|	0x0001
  *\endverbatim
  */
+#define M75_RX_DIRECT		M_DEV_OF+0x21
+/**<G,S: direct Rx delivery into a waiting M_getblock buffer, cur channel */
+/*!< SYNC mode only.\n
+ *   When enabled and an M_getblock call is waiting on an empty Rx queue,
+ *   the next received frame is read from the external Rx FIFO straight into
+ *   the buffer of the waiting call instead of into the Rx queue. This saves
+ *   the copy from the Rx queue into the user buffer. Frames which do not fit
+ *   into the waiting buffer or arrive while no M_getblock call is waiting are
+ *   queued as usual.\n
+ *   possible values: 0: disabled (default); 1: enabled
+ */
+#define M75_TX_DIRECT		M_DEV_OF+0x22
+/**<G,S: direct Tx from the M_setblock buffer, cur channel */
+/*!< SYNC mode only.\n
+ *   When enabled and the transmitter is idle with an empty Tx queue,
+ *   M_setblock writes the frame from the user buffer straight into the
+ *   external Tx FIFO and starts transmission, without copying it into the
+ *   Tx queue first. Otherwise the frame is queued as usual.\n
+ *   possible values: 0: disabled (default); 1: enabled
+ */
+#define M75_RX_BATCH		M_DEV_OF+0x23
+/**<G,S: batched M_getblock, cur channel */
+/*!< When enabled, one M_getblock call returns as many received frames as fit
+ *   into the user buffer. Each frame is passed as a record consisting of a
+ *   M75_RX_REC_HDR followed by the frame data. The next record starts at
+ *   M75_RX_REC_SIZE(hdr->size) bytes after the start of the current one.
+ *   M_getblock returns the total number of bytes of all records.\n
+ *   The buffer must at least hold the record of the first frame in the
+ *   Rx queue, otherwise M75_ERR_FRAMETOOLARGE is returned.\n
+ *   possible values: 0: one frame per call (default); 1: batch mode
+ */
+#define M75_TX_BATCH		M_DEV_OF+0x24
+/**<G,S: batched M_setblock, cur channel */
+/*!< When enabled, the M_setblock buffer holds a sequence of records, each
+ *   consisting of a M75_TX_REC_HDR followed by the frame data, padded to
+ *   M75_TX_REC_SIZE(hdr->size). A record with size 0 ends the sequence.
+ *   All frames which fit into the Tx queue are queued with one call and
+ *   transmission is started once. M_setblock returns the number of bytes of
+ *   the records accepted, M75_TX_BATCH_CNT the number of frames.\n
+ *   The call only waits (M75_SETBLOCK_TOUT) while the Tx queue is full.\n
+ *   possible values: 0: one frame per call (default); 1: batch mode
+ */
+#define M75_TX_BATCH_CNT	M_DEV_OF+0x25
+/**<G  : number of frames accepted by last batched M_setblock, cur channel */
+#define M75_RX_TSTAMP		M_DEV_OF+0x26
+/**<G,S: timestamped M_getblock, cur channel */
+/*!< Every received frame is stamped by the ISR when the end of frame is
+ *   detected (SYNC mode) or when its first character is received (ASYNC
+ *   mode). When enabled, M_getblock passes the u_int32 timestamp in front of
+ *   the frame data and returns the frame size + 4. In batch mode
+ *   (M75_RX_BATCH) the timestamp is always passed in the record header.\n
+ *   possible values: 0: disabled (default); 1: enabled
+ */
+#define M75_TSTAMP_RATE		M_DEV_OF+0x27
+/**<G  : timestamp ticks per second */
+#define M75_STATS_CLR		M_DEV_OF+0x28
+/**<  S: reset statistics (M75_BLK_STATS), cur channel */
+#define M75_REG_CACHED		M_DEV_OF+0x29
+/**<G,S: SCC register GetStats from the register mirror, cur channel */
+/*!< When enabled, GetStats of registers which read back a write register
+ *   (M75_SCC_REG_09/11/12/13/15, M75_BRGEN_TCONST and, with extended read,
+ *   M75_SCC_REG_04/05/14) are answered from the driver's mirror of the
+ *   WRxx registers without accessing the SCC. Status registers are always
+ *   read from the SCC.\n
+ *   possible values: 0: read SCC (default); 1: read mirror
+ */
+#define M75_ASY_TX_FIFO		M_DEV_OF+0x2A
+/**<G,S: ASYNC mode: transmit through the external Tx FIFO, cur channel */
+/*!< When enabled, each Tx queue entry is written into the external Tx FIFO
+ *   as a whole and fed to the SCC by the FIFO logic. The Tx interrupt is
+ *   disabled; an alarm checks once per entry, after its estimated
+ *   transmission time, that the FIFO has drained.
+ *   Change only while the Tx queue is empty.
+ *   Initial value from descriptor key CHAN_n/ASYNC_TX_FIFO.\n
+ *   possible values: 0: Tx interrupt per character (default); 1: FIFO
+ */
+#define M75_ASY_RX_BURST	M_DEV_OF+0x2B
+/**<G,S: ASYNC mode: check Rx errors once per burst, cur channel */
+/*!< The Rx interrupt reads all characters from the SCC Rx FIFO. Normally
+ *   RR01 is read before every character. When enabled, RR01 is read once
+ *   when the FIFO is drained, since the SCC latches Rx overrun and parity
+ *   errors until Error Reset. This cuts the bus accesses per character
+ *   from four to two. The characters of the burst are kept in the Rx
+ *   queue and the error is returned by the next M_getblock. Framing errors
+ *   are not latched and only seen if pending at the end of a burst.
+ *   Initial value from descriptor key CHAN_n/ASYNC_RX_BURST.\n
+ *   possible values: 0: check every character (default); 1: per burst
+ */
+#define M75_ASY_RX_MARK		M_DEV_OF+0x2C
+/**<G,S: ASYNC mode: Rx water mark to wake reader, cur channel */
+/*!< A waiting M_getblock is woken and the Rx signal is sent when the
+ *   current Rx queue entry holds this number of characters or is full.
+ *   The signal is sent once per queue entry. Raising the mark coalesces
+ *   wakeups on fast lines; combine with M75_ASY_RX_IDLE to pass the tail
+ *   of a message. Initial value from descriptor key
+ *   CHAN_n/ASYNC_RX_SIG_MARK.\n
+ *   possible values: 1 (default) .. MAX_RXFRAME_SIZE
+ */
+
+#define M75_ASY_RX_IDLE		M_DEV_OF+0x2D
+/**<G,S: ASYNC mode: Rx idle time to wake reader, cur channel */
+/*!< When characters below the water mark (M75_ASY_RX_MARK) are pending and
+ *   no further character is received for this time, a waiting M_getblock
+ *   is woken and the Rx signal is sent. Initial value from descriptor key
+ *   CHAN_n/ASYNC_RX_IDLE.\n
+ *   possible values: 0: off (default); n: idle time in msec
+ */
+
+#define M75_RX_POLL_HI		M_DEV_OF+0x2E
+/**<G,S: SYNC mode: Rx irqs per sec to switch to polling, cur channel */
+/*!< When more Rx interrupts than this are counted within one second, the
+ *   Rx interrupt of the channel is disabled and the status FIFO is polled
+ *   every M75_RX_POLL_MSEC. This saves the fixed interrupt overhead at high
+ *   rates of small frames. Setting 0 returns to interrupt mode. M75_STATS
+ *   counts the switches and the time spent in each mode.
+ *   Initial value from descriptor key CHAN_n/RX_POLL_HI.\n
+ *   possible values: 0: always interrupt mode (default); n: irqs/sec
+ */
+
+#define M75_RX_POLL_LO		M_DEV_OF+0x2F
+/**<G,S: SYNC mode: Rx frames per sec to leave polling, cur channel */
+/*!< In polling mode, when less frames than this were received within one
+ *   second, the channel returns to interrupt mode. Should be well below
+ *   M75_RX_POLL_HI. Initial value from descriptor key CHAN_n/RX_POLL_LO.\n
+ *   possible values: 0..n frames/sec, default 100
+ */
+
+#define M75_RX_POLL_MSEC	M_DEV_OF+0x30
+/**<G,S: SYNC mode: Rx poll interval, cur channel */
+/*!< Interval of the status FIFO polls in polling mode. Takes effect with
+ *   the next switch to polling mode. The status FIFO holds 10 frames, so
+ *   the interval must be shorter than the time for 10 frames on the line.
+ *   Initial value from descriptor key CHAN_n/RX_POLL_MSEC.\n
+ *   possible values: 1..n msec, default 10
+ */
+
+#define M75_RX_POLL_MODE	M_DEV_OF+0x31
+/**<G: SYNC mode: current Rx mode, cur channel */
+/*!< possible values: 0: interrupt mode; 1: polling mode */
+
+#define M75_RX_DEFER		M_DEV_OF+0x32
+/**<G,S: SYNC mode: read Rx frames outside the ISR, cur channel */
+/*!< The Rx interrupt only reads the status FIFO entries. An OSS alarm
+ *   copies the frames (up to 2KB each) from the external Rx FIFO one tick
+ *   later. This shortens the time the interrupt blocks other devices
+ *   and the other channel, but adds one tick of latency. With the Rx queue
+ *   full, frames are dropped instead of being kept in the status FIFO.
+ *   Initial value from descriptor key CHAN_n/RX_DEFER.\n
+ *   possible values: 0: read in ISR (default); 1: deferred
+ */
+
+#define M75_RX_BUDGET		M_DEV_OF+0x33
+/**<G,S: SYNC mode: max. frames per Rx interrupt service, cur channel */
+/*!< Limits the status FIFO entries read per Rx IP service. The ISR then
+ *   serves the other channel before it comes back for the rest; the
+ *   channel served first alternates. This bounds the service latency of
+ *   one channel while the other receives back-to-back small frames.
+ *   Every frame may need up to MAX_RXFRAME_SIZE bytes to be copied, unless
+ *   M75_RX_DEFER is set. M75_STATS counts the services cut by the budget.
+ *   Initial value from descriptor key CHAN_n/RX_BUDGET.\n
+ *   possible values: 0: unlimited (default); n: frames
+ */
+
+#define M75_STORM_LOOPS		M_DEV_OF+0x34
+/**<G,S: interrupt storm: max. RR03 passes per ISR call, all channels */
+/*!< When IPs are still pending after this many passes, the ISR disables
+ *   the interrupt sources still pending (Rx, Tx or Ext/Status in WR01) and
+ *   returns. The sources are enabled again after M75_STORM_MSEC.
+ *   Initial value from descriptor key IRQ_STORM_LOOPS.
+
+ *   possible values: 0: off; n: passes, default 100
+ */
+
+#define M75_STORM_RATE		M_DEV_OF+0x35
+/**<G,S: interrupt storm: max. interrupts/sec per channel, all channels */
+/*!< When a channel is serviced more often within one second, the sources
+ *   just serviced are disabled for M75_STORM_MSEC. Must be well above the
+ *   rate of the expected traffic (and M75_RX_POLL_HI, if used).
+ *   Initial value from descriptor key IRQ_STORM_RATE.
+
+ *   possible values: 0: off (default); n: interrupts/sec
+ */
+
+#define M75_STORM_MSEC		M_DEV_OF+0x36
+/**<G,S: interrupt storm: backoff before sources are enabled again */
+/*!< Initial value from descriptor key IRQ_STORM_MSEC.
+
+ *   possible values: 1..n msec, default 100
+ */
+
+#define M75_SETSTORMSIG		M_DEV_OF+0x37
+/**<S: install interrupt storm signal, cur channel */
+/*!< Sent when storm detection disables sources of the channel and again
+ *   when they are enabled. */
+#define M75_CLRSTORMSIG		M_DEV_OF+0x38
+/**<S: remove interrupt storm signal, cur channel */
+
+#define M75_STORM_STATE		M_DEV_OF+0x39
+/**<G: interrupt storm: sources disabled, cur channel */
+/*!< possible values: 0: none; else WR01 interrupt enable bits disabled
+ *   until the backoff expired (0x01 Ext/Status, 0x02 Tx, 0x18 Rx) */
+
+#define M75_TX_ID			M_DEV_OF+0x3A
+/**<G: id of the last frame accepted by M_setblock, cur channel */
+/*!< Every frame passed with M_setblock gets the next id (free running,
+ *   the first frame gets 1). With M75_TX_BATCH, the frames of one call
+ *   got the ids M75_TX_ID - M75_TX_BATCH_CNT + 1 .. M75_TX_ID.
+ *   M75_BLK_TX_DONE reports the completion of the frames by id. */
+
+#define M75_SETTXSIG		M_DEV_OF+0x3B
+/**<S: install Tx completion signal, cur channel */
+/*!< SYNC mode: sent for every frame completed, see M75_BLK_TX_DONE */
+#define M75_CLRTXSIG		M_DEV_OF+0x3C
+/**<S: remove Tx completion signal, cur channel */
+
+#define M75_TX_DRAIN		M_DEV_OF+0x3D
+/**<S: wait until all frames are sent, cur channel */
+/*!< Returns when the Tx queue and the external Tx FIFO are empty and the
+ *   SCC has finished the last frame (SYNC: Tx Underrun/EOM, the closing
+ *   CRC and flag follow within 3 byte times; ASYNC: All Sent), or with
+ *   ERR_OSS_TIMEOUT. Frames passed meanwhile by other paths are waited for
+ *   as well.\n
+ *   value: timeout (msec), 0: check only, -1: wait endless
+ */
+
+#define M75_EV_MASK			M_DEV_OF+0x3E
+/**<G,S: readiness events of interest, both channels */
+/*!< Bit mask of M75_EV_CH(ch,ev) events checked by M75_EV_STATE,
+ *   M75_EV_WAIT and the M75_SETEVSIG signal (device, not channel
+ *   specific). Default: M75_EV_RX and M75_EV_ERR of both channels */
+
+#define M75_EV_STATE		M_DEV_OF+0x3F
+/**<G: ready events of interest, both channels */
+/*!< Returns the events of M75_EV_MASK currently ready, without waiting.
+ *   The events are levels: M75_EV_RX stays set until the Rx queue has been
+ *   read empty, M75_EV_ERR until M_getblock returned the error.
+ *   Also re-arms the M75_SETEVSIG signal. */
+
+#define M75_EV_WAIT			M_DEV_OF+0x40
+/**<S: wait for a ready event of interest, both channels */
+/*!< Returns when M75_EV_STATE is not 0, or with ERR_OSS_TIMEOUT.
+ *   Only one thread per device may wait, a second one gets
+ *   ERR_OSS_BUSY_RESOURCE.\n
+ *   value: timeout (msec), 0: check only, -1: wait endless */
+
+#define M75_SETEVSIG		M_DEV_OF+0x41
+/**<S: install readiness signal, both channels */
+/*!< Sent once when an event of M75_EV_MASK gets ready; re-armed by
+ *   M75_EV_STATE. Installing the same signal on several devices lets one
+ *   thread serve all of them: wait for the signal, then read M75_EV_STATE
+ *   of every device. */
+#define M75_CLREVSIG		M_DEV_OF+0x42
+/**<S: remove readiness signal */
+
+#define M75_RX_SIG_FRAMES	M_DEV_OF+0x43
+/**<G,S: SYNC mode: frames per Rx signal, cur channel */
+/*!< The M75_SETRXSIG signal is sent when this number of frames was
+ *   received since the last signal, or when M75_RX_SIG_USEC expired,
+ *   whichever comes first. Rx errors are signalled at once.
+ *   Initial value from descriptor key CHAN_n/RX_SIG_FRAMES.\n
+ *   possible values: 1: signal every frame (default); n: frames
+ */
+
+#define M75_RX_SIG_USEC		M_DEV_OF+0x44
+/**<G,S: SYNC mode: max. Rx signal delay, cur channel */
+/*!< Time after the first frame not signalled yet until the M75_SETRXSIG
+ *   signal is sent, see M75_RX_SIG_FRAMES. Rounded up to the resolution
+ *   of the OSS alarms (msec or system tick). With 0, frames below
+ *   M75_RX_SIG_FRAMES wait for the next frame.
+ *   Initial value from descriptor key CHAN_n/RX_SIG_USEC.\n
+ *   possible values: 0: no timeout (default); n: usec
+ */
 
 /**@}*/
 #define M75_SCC_REG_00		M_DEV_OF+0x00
@@ -498,6 +845,51 @@ typedef struct {
 #define M75_SCC_REGS 		M_DEV_BLK_OF+0x00
 							/**<G: get all SCC WRxx registers (BlockGetstat) */
 							/*!< returns a structure of type M75_SCC_REGS_PB */
+#define M75_BLK_STATS		M_DEV_BLK_OF+0x01
+							/**<G: get statistics, cur channel (BlockGetstat) */
+							/*!< returns a structure of type M75_STATS */
+#define M75_BLK_STATS_CLR	M_DEV_BLK_OF+0x02
+							/**<G: get and reset statistics, cur channel */
+							/*!< returns a structure of type M75_STATS, the
+							 *   counters are reset within the same snapshot */
+#define M75_BLK_IRQSTATS	M_DEV_BLK_OF+0x03
+							/**<G: get ISR statistics, both channels */
+							/*!< returns a structure of type M75_IRQSTATS,
+							 *   only if driver built with M75_IRQ_STATS */
+#define M75_BLK_IRQSTATS_CLR M_DEV_BLK_OF+0x04
+							/**<G: get and reset ISR statistics */
+#define M75_BLK_TX_DONE		M_DEV_BLK_OF+0x05
+							/**<G: read Tx completions, cur channel */
+							/*!< SYNC mode: returns the M75_TX_DONE records of
+							 *   the frames sent since the last call, oldest
+							 *   first, as many as fit into the buffer.
+							 *   blk->size returns the number of bytes. The
+							 *   driver keeps the last 64 completions, older
+							 *   ones are counted in M75_STATS txDoneLost. */
+/**@}*/
+
+/** \name M75 batch record definitions (M75_RX_BATCH/M75_TX_BATCH) */
+/**@{*/
+#define M75_RXREC_ERR_PENDING	0x0001
+/**< Rx error detected after this frame, returned by the next M_getblock */
+#define M75_REC_ALIGN(n)		(((n)+3) & ~3)
+/**< frame data in records is padded to 4 byte boundaries */
+#define M75_RX_REC_SIZE(n)		(sizeof(M75_RX_REC_HDR) + M75_REC_ALIGN(n))
+/**< total size of a Rx record holding n frame bytes */
+#define M75_TX_REC_SIZE(n)		(sizeof(M75_TX_REC_HDR) + M75_REC_ALIGN(n))
+/**< total size of a Tx record holding n frame bytes */
+/**@}*/
+
+/** \name M75 readiness events (M75_EV_MASK/M75_EV_STATE) */
+/**@{*/
+#define M75_EV_RX				0x01
+/**< Rx data or frame available, M_getblock won't wait */
+#define M75_EV_TX				0x02
+/**< Tx queue has room for a frame, M_setblock won't wait */
+#define M75_EV_ERR				0x04
+/**< Rx error pending, returned by the next M_getblock */
+#define M75_EV_CH(ch,ev)		((ev) << ((ch)*8))
+/**< event bits \a ev of channel \a ch */
 /**@}*/
 
 /** \name M75 specific Error/Warning codes */